@@ -0,0 +1,65 @@
+// 回归用例:多播委托的多个订阅者都是解释器函数,参数中含有超过8字节的结构体。
+// 放入热更新程序集,调用 MulticastDelegateStructArgs.Run(),返回true表示通过。
+// 覆盖:结构体参数在eval stack中占多个StackObject、结构体之后的参数位置、
+// 前一个订阅者修改参数不影响后一个订阅者。
+using System;
+
+public static class MulticastDelegateStructArgs
+{
+    public struct Vec3
+    {
+        public float x, y, z;
+
+        public Vec3(float x, float y, float z)
+        {
+            this.x = x;
+            this.y = y;
+            this.z = z;
+        }
+    }
+
+    private static float s_sum1;
+    private static float s_sum2;
+    private static int s_tag1;
+    private static int s_tag2;
+
+    private static void OnVec1(Vec3 v)
+    {
+        s_sum1 = v.x + v.y + v.z;
+        v.x = 1000;
+    }
+
+    private static void OnVec2(Vec3 v)
+    {
+        s_sum2 = v.x + v.y + v.z;
+    }
+
+    private static void OnTagVec1(int tag, Vec3 v, int after)
+    {
+        s_tag1 = tag * 100 + after;
+        s_sum1 = v.x * v.y * v.z;
+        tag = -1;
+    }
+
+    private static void OnTagVec2(int tag, Vec3 v, int after)
+    {
+        s_tag2 = tag * 100 + after;
+        s_sum2 = v.x * v.y * v.z;
+    }
+
+    public static bool Run()
+    {
+        Action<Vec3> a = OnVec1;
+        a += OnVec2;
+        a(new Vec3(1, 2, 3));
+        if (s_sum1 != 6 || s_sum2 != 6)
+        {
+            return false;
+        }
+
+        Action<int, Vec3, int> b = OnTagVec1;
+        b += OnTagVec2;
+        b(7, new Vec3(2, 3, 4), 5);
+        return s_tag1 == 705 && s_tag2 == 705 && s_sum1 == 24 && s_sum2 == 24;
+    }
+}
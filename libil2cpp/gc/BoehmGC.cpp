@@ -516,11 +516,31 @@ void il2cpp::gc::GarbageCollector::UnregisterRoot(char* start)
     GC_call_with_alloc_lock(deregister_root, start);
 }
 
+//==={{ huatuo
+static il2cpp::gc::GarbageCollector::RootProviderCallback s_RootProvider;
+
+static void
+push_root_range(void* start, void* end)
+{
+    GC_push_all((char*)start, (char*)end);
+}
+
+void il2cpp::gc::GarbageCollector::SetRootProvider(RootProviderCallback provider)
+{
+    s_RootProvider = provider;
+}
+
+//===}} huatuo
+
 static void
 push_other_roots(void)
 {
     for (RootMap::iterator iter = s_Roots.begin(); iter != s_Roots.end(); ++iter)
         GC_push_all(iter->first, iter->second);
+    //==={{ huatuo
+    if (s_RootProvider)
+        s_RootProvider(push_root_range);
+    //===}} huatuo
     if (default_push_other_roots)
         default_push_other_roots();
 }
@@ -105,6 +105,13 @@ namespace gc
         static void RegisterRoot(char *start, size_t size);
         static void UnregisterRoot(char* start);
 
+        //==={{ huatuo
+        // 范围会变化的根。每次标记时调用provider,由它通过pushRange提交当前的根范围[start, end)
+        typedef void (*PushRootRangeCallback)(void* start, void* end);
+        typedef void (*RootProviderCallback)(PushRootRangeCallback pushRange);
+        static void SetRootProvider(RootProviderCallback provider);
+        //===}} huatuo
+
         static void SetSkipThread(bool skip);
     };
 } /* namespace vm */
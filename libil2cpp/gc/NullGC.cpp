@@ -177,6 +177,13 @@ void* il2cpp::gc::GarbageCollector::CallWithAllocLockHeld(GCCallWithAllocLockCal
     return callback(user_data);
 }
 
+//==={{ huatuo
+void il2cpp::gc::GarbageCollector::SetRootProvider(RootProviderCallback provider)
+{
+}
+
+//===}} huatuo
+
 int64_t
 il2cpp::gc::GarbageCollector::GetMaxTimeSliceNs()
 {
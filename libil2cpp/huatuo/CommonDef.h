@@ -7,6 +7,55 @@
 #include "utils/Memory.h"
 #include "vm/GlobalMetadataFileInternals.h"
 
+// 解释器指令分发方式。支持label-as-value(computed goto)的编译器使用threaded dispatch,
+// 每条指令执行完后直接跳转到下一条指令的handler；否则回退为switch分发。
+#ifndef HUATUO_ENABLE_THREADED_DISPATCH
+#if defined(__GNUC__) || defined(__clang__)
+#define HUATUO_ENABLE_THREADED_DISPATCH 1
+#else
+#define HUATUO_ENABLE_THREADED_DISPATCH 0
+#endif
+#endif
+
+// 访问静态字段的指令首次执行且类构造函数执行完后,将自身改写为不检查类构造函数的版本。
+#ifndef HUATUO_ENABLE_STATIC_FIELD_OPCODE_PATCHING
+#define HUATUO_ENABLE_STATIC_FIELD_OPCODE_PATCHING 1
+#endif
+
+// 平台是否支持只预留地址空间、使用时再提交内存。不支持时解释器栈在线程首次使用时一次性分配。
+#if IL2CPP_TARGET_WINDOWS_DESKTOP || IL2CPP_TARGET_DARWIN || IL2CPP_TARGET_LINUX || IL2CPP_TARGET_ANDROID
+#define HUATUO_SUPPORT_RESERVE_MEMORY 1
+#else
+#define HUATUO_SUPPORT_RESERVE_MEMORY 0
+#endif
+
+// 每个线程解释器栈的最大StackObject数与最大帧数
+#ifndef HUATUO_MAX_STACK_OBJECT_COUNT
+#if HUATUO_SUPPORT_RESERVE_MEMORY
+#define HUATUO_MAX_STACK_OBJECT_COUNT (1024 * 1024)
+#else
+#define HUATUO_MAX_STACK_OBJECT_COUNT (1024 * 128)
+#endif
+#endif
+
+#ifndef HUATUO_MAX_FRAME_COUNT
+#if HUATUO_SUPPORT_RESERVE_MEMORY
+#define HUATUO_MAX_FRAME_COUNT (1024 * 64)
+#else
+#define HUATUO_MAX_FRAME_COUNT 1024
+#endif
+#endif
+
+// 分层转换的默认阈值。函数先做不带优化的快速转换,调用次数或循环回跳次数达到阈值后再做优化转换。
+// 调用次数阈值为0时关闭分层,首次调用即优化转换。运行时可用huatuo_set_tier_up_thresholds修改。
+#ifndef HUATUO_TIER_UP_INVOKE_THRESHOLD
+#define HUATUO_TIER_UP_INVOKE_THRESHOLD 100
+#endif
+
+#ifndef HUATUO_TIER_UP_BACK_EDGE_THRESHOLD
+#define HUATUO_TIER_UP_BACK_EDGE_THRESHOLD 10000
+#endif
+
 namespace huatuo
 {
 
@@ -12,6 +12,7 @@
 #include "interpreter/InterpreterModule.h"
 #include "metadata/MetadataModule.h"
 #include "transform/Transform.h"
+#include "transform/TemporaryMemoryArena.h"
 
 using namespace il2cpp;
 
@@ -29,4 +30,10 @@ namespace huatuo
 		interpreter::InterpreterModule::Initialize();
         PostInit();
 	}
+
+	void ModuleManager::UninitializeCurrentThread()
+	{
+		interpreter::InterpreterModule::FreeCurrentThreadMachineState();
+		transform::TemporaryMemoryArenaScope::FreeCurrentThreadArena();
+	}
 }
\ No newline at end of file
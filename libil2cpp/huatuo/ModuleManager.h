@@ -8,5 +8,8 @@ namespace huatuo
 	{
 	public:
 		static void Initialize();
+
+		// 托管线程退出前调用,释放线程相关的数据
+		static void UninitializeCurrentThread();
 	};
 }
\ No newline at end of file
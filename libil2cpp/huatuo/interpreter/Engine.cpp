@@ -79,17 +79,103 @@ namespace interpreter
 	}
 
 
-	InterpFrame* InterpFrameGroup::EnterFrame(const InterpMethodInfo* imi, StackObject* argBase, bool withArgStack)
+	MachineState* MachineState::s_head;
+
+	MachineState::MachineState() : _prev(nullptr), _next(nullptr)
+	{
+		_stackMemory.Reserve(kMaxStackObjectCount * sizeof(StackObject));
+		_stackBase = (StackObject*)_stackMemory.GetBase();
+		_stackSize = 0;
+		_stackTopIdx = 0;
+
+		_frameMemory.Reserve(kMaxFrameCount * sizeof(InterpFrame));
+		_frameBase = (InterpFrame*)_frameMemory.GetBase();
+		_frameCount = 0;
+		_frameTopIdx = 0;
+
+		il2cpp::gc::GarbageCollector::CallWithAllocLockHeld(LinkMachineState, this);
+	}
+
+	MachineState::~MachineState()
+	{
+		il2cpp::gc::GarbageCollector::CallWithAllocLockHeld(UnlinkMachineState, this);
+	}
+
+	void* MachineState::LinkMachineState(void* state)
+	{
+		MachineState* ms = (MachineState*)state;
+		ms->_next = s_head;
+		if (s_head)
+		{
+			s_head->_prev = ms;
+		}
+		s_head = ms;
+		return nullptr;
+	}
+
+	void* MachineState::UnlinkMachineState(void* state)
+	{
+		MachineState* ms = (MachineState*)state;
+		if (ms->_prev)
+		{
+			ms->_prev->_next = ms->_next;
+		}
+		else
+		{
+			s_head = ms->_next;
+		}
+		if (ms->_next)
+		{
+			ms->_next->_prev = ms->_prev;
+		}
+		return nullptr;
+	}
+
+	// GC标记时世界已暂停且持有分配锁,链表与栈顶都不会变化
+	void MachineState::PushStackRoots(il2cpp::gc::GarbageCollector::PushRootRangeCallback pushRange)
+	{
+		for (MachineState* ms = s_head; ms; ms = ms->_next)
+		{
+			if (ms->_stackTopIdx > 0)
+			{
+				pushRange(ms->_stackBase, ms->_stackBase + ms->_stackTopIdx);
+			}
+		}
+	}
+
+	void MachineState::RegisterGCRootProvider()
+	{
+		il2cpp::gc::GarbageCollector::SetRootProvider(PushStackRoots);
+	}
+
+	void MachineState::GrowStack(ptrdiff_t requiredSize, const char* allocType)
+	{
+		if (!_stackMemory.Commit(requiredSize * sizeof(StackObject)))
+		{
+			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException(allocType));
+		}
+		_stackSize = (ptrdiff_t)(_stackMemory.GetCommittedSize() / sizeof(StackObject));
+	}
+
+	void MachineState::GrowFrames()
+	{
+		if (!_frameMemory.Commit((_frameTopIdx + 1) * sizeof(InterpFrame)))
+		{
+			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocFrame"));
+		}
+		_frameCount = (uint32_t)(_frameMemory.GetCommittedSize() / sizeof(InterpFrame));
+	}
+
+	InterpFrame* InterpFrameGroup::EnterFrame(const InterpMethodInfo* imi, StackObject* argBase, FrameArgMode argMode)
 	{
 		ptrdiff_t oldStackTop = _machineState.GetStackTop();
 		InterpFrame* newFrame;
-		if (withArgStack)
+		if (argMode == FrameArgMode::InPlace)
 		{
 			StackObject* stackBasePtr = _machineState.AllocStackSlot(imi->maxStackSize - imi->argStackObjectSize);
 
 			newFrame = _machineState.PushFrame();
 			*newFrame = { imi, argBase, oldStackTop, nullptr, nullptr, ExceptionFlowType::None, 0, 0, 0 };
-			_frames.push(newFrame);
 		}
 		else
 		{
@@ -97,10 +183,12 @@ namespace interpreter
 
 			newFrame = _machineState.PushFrame();
 			*newFrame = { imi, stackBasePtr, oldStackTop, nullptr, nullptr, ExceptionFlowType::None, 0, 0, 0 };
-			_frames.push(newFrame);
 
-			// if not prepare arg stack. copy from args
-			if (!withArgStack && imi->args)
+			if (argMode == FrameArgMode::CopyStack)
+			{
+				std::memcpy(stackBasePtr, argBase, imi->argStackObjectSize * sizeof(StackObject));
+			}
+			else if (imi->args)
 			{
 				IL2CPP_ASSERT(imi->argCount == metadata::GetActualArgumentNum(imi->method));
 				if (imi->isTrivialCopyArgs)
@@ -117,6 +205,23 @@ namespace interpreter
 		return newFrame;
 	}
 
+	bool InterpFrameGroup::ReplaceFrameMethod(InterpFrame* frame, const InterpMethodInfo* imi)
+	{
+		const InterpMethodInfo* oldImi = frame->method;
+		IL2CPP_ASSERT(oldImi->method == imi->method && oldImi->localStackSize == imi->localStackSize && oldImi->evalStackBaseOffset == imi->evalStackBaseOffset);
+		if (imi->maxStackSize > oldImi->maxStackSize)
+		{
+			ptrdiff_t frameEnd = frame->stackBasePtr + oldImi->maxStackSize - _machineState.GetStackBasePtr();
+			if (_machineState.GetStackTop() != frameEnd)
+			{
+				return false;
+			}
+			_machineState.AllocStackSlot(imi->maxStackSize - oldImi->maxStackSize);
+		}
+		frame->method = imi;
+		return true;
+	}
+
 }
 }
 
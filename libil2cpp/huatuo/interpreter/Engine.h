@@ -1,12 +1,11 @@
 #pragma once
 
-#include <stack>
-
 #include "gc/GarbageCollector.h"
 #include "vm/Exception.h"
 #include "vm/StackTrace.h"
 
 #include "../CommonDef.h"
+#include "ReservedMemory.h"
 
 #if DEBUG
 #define PUSH_STACK_FRAME(method) do { \
@@ -73,34 +72,34 @@ namespace interpreter
 		//std::vector<void*> *bigLocalAllocs;
 	};
 
-	const uint32_t kMaxStackObjectCount = 1024 * 128;
-	const uint32_t kMaxFrameCount = 1024;
+	// 进入新帧时参数的来源
+	enum class FrameArgMode
+	{
+		InPlace, // 已按被调函数的布局放在调用者eval stack的栈顶,直接作为新帧的开头
+		Native, // native调用传入的参数数组,每个参数一个StackObject,按类型展开复制
+		CopyStack, // 已按被调函数的布局存放但不在栈顶(如多播委托),整段复制,原参数保持不变
+	};
 
+	const uint32_t kMaxStackObjectCount = HUATUO_MAX_STACK_OBJECT_COUNT;
+	const uint32_t kMaxFrameCount = HUATUO_MAX_FRAME_COUNT;
+
+	// 栈和帧数组都只预留地址空间,用到时才提交内存,线程退出时归还。
+	// _stackSize、_frameCount为已提交的大小,超出时再提交,直到预留的上限。
+	// 栈不是GC堆内存,GC标记时只扫描各线程栈中[0, _stackTopIdx)的部分。
 	class MachineState
 	{
 	public:
-		MachineState()
-		{
-			_stackSize = kMaxStackObjectCount;
-			_stackBase = (StackObject*)il2cpp::gc::GarbageCollector::AllocateFixed(kMaxStackObjectCount * sizeof(StackObject), nullptr);
-			std::memset(_stackBase, 0, _stackSize * sizeof(StackObject));
-			_stackTopIdx = 0;
-
-			_frameBase = (InterpFrame*)IL2CPP_CALLOC(kMaxFrameCount, sizeof(InterpFrame));
-			_frameCount = kMaxFrameCount;
-			_frameTopIdx = 0;
-		}
+		MachineState();
+		~MachineState();
 
-		~MachineState()
-		{
-			il2cpp::gc::GarbageCollector::FreeFixed(_stackBase);
-		}
+		// 注册为GC的根提供者,在InterpreterModule::Initialize中调用
+		static void RegisterGCRootProvider();
 
 		StackObject* AllocArgments(uint32_t argCount)
 		{
 			if (_stackTopIdx + argCount > _stackSize)
 			{
-				il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocArguments"));
+				GrowStack(_stackTopIdx + argCount, "AllocArguments");
 			}
 			StackObject* args = _stackBase + _stackTopIdx;
 			_stackTopIdx += argCount;
@@ -121,7 +120,7 @@ namespace interpreter
 		{
 			if (_stackTopIdx + slotNum > _stackSize)
 			{
-				il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocStackSlot"));
+				GrowStack(_stackTopIdx + slotNum, "AllocStackSlot");
 			}
 			StackObject* dataPtr = _stackBase + _stackTopIdx;
 			_stackTopIdx += slotNum;
@@ -137,7 +136,7 @@ namespace interpreter
 		{
 			if (_frameTopIdx >= _frameCount)
 			{
-				il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocFrame"));
+				GrowFrames();
 			}
 			return _frameBase + _frameTopIdx++;
 		}
@@ -154,28 +153,54 @@ namespace interpreter
 			_frameTopIdx -= count;
 		}
 
+		uint32_t GetFrameTopIdx() const
+		{
+			return _frameTopIdx;
+		}
+
+		InterpFrame* GetTopFrame() const
+		{
+			IL2CPP_ASSERT(_frameTopIdx > 0);
+			return _frameBase + _frameTopIdx - 1;
+		}
+
 	private:
+		void GrowStack(ptrdiff_t requiredSize, const char* allocType);
+		void GrowFrames();
 
+		static void* LinkMachineState(void* state);
+		static void* UnlinkMachineState(void* state);
+		static void PushStackRoots(il2cpp::gc::GarbageCollector::PushRootRangeCallback pushRange);
+
+		// 所有线程的MachineState组成的链表,只在持有GC分配锁时修改和遍历
+		static MachineState* s_head;
+		MachineState* _prev;
+		MachineState* _next;
+
+		ReservedMemory _stackMemory;
 		StackObject* _stackBase;
 		ptrdiff_t _stackSize;
 		ptrdiff_t _stackTopIdx;
 
+		ReservedMemory _frameMemory;
 		InterpFrame* _frameBase;
 		uint32_t _frameTopIdx;
 		uint32_t _frameCount;
 	};
 
+	// 一次Interpreter::Execute调用压入的帧。帧在MachineState的帧数组中连续存放,
+	// 上一帧即前一个元素,_frameBaseIdx之前的帧属于外层的Execute调用。
 	class InterpFrameGroup
 	{
 	public:
-		InterpFrameGroup(MachineState& ms) : _machineState(ms), _stackBaseIdx(ms.GetStackTop())
+		InterpFrameGroup(MachineState& ms) : _machineState(ms), _stackBaseIdx(ms.GetStackTop()), _frameBaseIdx(ms.GetFrameTopIdx())
 		{
 
 		}
 
 		void CleanUpFrames()
 		{
-			uint32_t n = (uint32_t)_frames.size();
+			uint32_t n = _machineState.GetFrameTopIdx() - _frameBaseIdx;
 			if (n > 0)
 			{
 				_machineState.SetStackTop(_stackBaseIdx);
@@ -183,19 +208,22 @@ namespace interpreter
 			}
 		}
 
-		InterpFrame* EnterFrame(const InterpMethodInfo* imi, StackObject* argBase, bool withArgStack);
+		InterpFrame* EnterFrame(const InterpMethodInfo* imi, StackObject* argBase, FrameArgMode argMode);
 
 		InterpFrame* LeaveFrame()
 		{
-			IL2CPP_ASSERT(!_frames.empty());
+			IL2CPP_ASSERT(_machineState.GetFrameTopIdx() > _frameBaseIdx);
 			POP_STACK_FRAME();
-			InterpFrame* frame = _frames.top();
-			_machineState.PopFrame();
+			InterpFrame* frame = _machineState.GetTopFrame();
 			_machineState.SetStackTop(frame->oldStackTop);
-			_frames.pop();
-			return _frames.empty() ? nullptr : _frames.top();
+			_machineState.PopFrame();
+			return _machineState.GetFrameTopIdx() > _frameBaseIdx ? frame - 1 : nullptr;
 		}
 
+		// 栈上替换时帧改为执行同一函数的另一个版本。新版本需要更多栈空间时,
+		// 帧必须位于栈顶且没有用localloc分配过内存,否则返回false
+		bool ReplaceFrameMethod(InterpFrame* frame, const InterpMethodInfo* imi);
+
 		void* AllocLoc(size_t size)
 		{
 			uint32_t soNum = (uint32_t)(size + sizeof(StackObject) - 1) / sizeof(StackObject);
@@ -204,7 +232,7 @@ namespace interpreter
 	private:
 		MachineState& _machineState;
 		ptrdiff_t _stackBaseIdx;
-		std::stack<InterpFrame*> _frames;
+		uint32_t _frameBaseIdx;
 	};
 }
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "GenericMethodCache.h"
+
+#include "metadata/GenericMetadata.h"
+
+#include "LockFreeHashMap.h"
+
+namespace huatuo
+{
+namespace interpreter
+{
+	struct InflatedMethodKey
+	{
+		const MethodInfo* methodDefinition;
+		const Il2CppGenericInst* classInst;
+		const Il2CppGenericInst* methodInst;
+	};
+
+	struct InflatedMethodKeyHash
+	{
+		uint32_t operator()(const InflatedMethodKey& key) const
+		{
+			uint64_t hash = (uint64_t)(uintptr_t)key.methodDefinition;
+			hash = hash * 31 + (uint64_t)(uintptr_t)key.classInst;
+			hash = hash * 31 + (uint64_t)(uintptr_t)key.methodInst;
+			return (uint32_t)(hash ^ (hash >> 29));
+		}
+	};
+
+	struct InflatedMethodKeyEqual
+	{
+		bool operator()(const InflatedMethodKey& a, const InflatedMethodKey& b) const
+		{
+			return a.methodDefinition == b.methodDefinition && a.classInst == b.classInst && a.methodInst == b.methodInst;
+		}
+	};
+
+	static LockFreeHashMap<InflatedMethodKey, const MethodInfo*, InflatedMethodKeyHash, InflatedMethodKeyEqual> s_inflatedMethods(1024);
+
+	const MethodInfo* GenericMethodCache::Inflate(const MethodInfo* methodDefinition, const Il2CppGenericContext* context)
+	{
+		InflatedMethodKey key = { methodDefinition, context->class_inst, context->method_inst };
+		const MethodInfo* inflatedMethod;
+		if (s_inflatedMethods.TryGetValue(key, inflatedMethod))
+		{
+			return inflatedMethod;
+		}
+
+		inflatedMethod = il2cpp::metadata::GenericMetadata::Inflate(methodDefinition, context);
+		s_inflatedMethods.Add(key, inflatedMethod);
+		return inflatedMethod;
+	}
+}
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../CommonDef.h"
+
+namespace huatuo
+{
+namespace interpreter
+{
+
+	// 缓存 (泛型函数定义, 泛型参数) -> 实例化函数。
+	// GenericMetadata::Inflate 每次都要加锁查全局表,解释器调用泛型虚函数时走这里,命中时无锁。
+	// GenericInst是全局唯一的,可以直接用指针作为key。
+	class GenericMethodCache
+	{
+	public:
+		static const MethodInfo* Inflate(const MethodInfo* methodDefinition, const Il2CppGenericContext* context);
+	};
+}
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include <cmath>
+
 #include "../CommonDef.h"
 
 namespace huatuo
@@ -30,6 +32,147 @@ namespace interpreter
 	};
 	static_assert(sizeof(HtVector4) == 16, "Vector4");
 
+	struct HtQuaternion
+	{
+		float x;
+		float y;
+		float z;
+		float w;
+	};
+	static_assert(sizeof(HtQuaternion) == 16, "Quaternion");
+
+	// 与UnityEngine中的实现保持一致。向量按float数组逐分量计算,便于编译器生成SIMD指令
+
+	template<typename T>
+	inline T HtVectorAdd(const T& a, const T& b)
+	{
+		T r;
+		const float* pa = (const float*)&a;
+		const float* pb = (const float*)&b;
+		float* pr = (float*)&r;
+		for (size_t i = 0; i < sizeof(T) / sizeof(float); i++)
+		{
+			pr[i] = pa[i] + pb[i];
+		}
+		return r;
+	}
+
+	template<typename T>
+	inline T HtVectorSub(const T& a, const T& b)
+	{
+		T r;
+		const float* pa = (const float*)&a;
+		const float* pb = (const float*)&b;
+		float* pr = (float*)&r;
+		for (size_t i = 0; i < sizeof(T) / sizeof(float); i++)
+		{
+			pr[i] = pa[i] - pb[i];
+		}
+		return r;
+	}
+
+	template<typename T>
+	inline T HtVectorNeg(const T& a)
+	{
+		T r;
+		const float* pa = (const float*)&a;
+		float* pr = (float*)&r;
+		for (size_t i = 0; i < sizeof(T) / sizeof(float); i++)
+		{
+			pr[i] = -pa[i];
+		}
+		return r;
+	}
+
+	template<typename T>
+	inline T HtVectorMulScalar(const T& a, float d)
+	{
+		T r;
+		const float* pa = (const float*)&a;
+		float* pr = (float*)&r;
+		for (size_t i = 0; i < sizeof(T) / sizeof(float); i++)
+		{
+			pr[i] = pa[i] * d;
+		}
+		return r;
+	}
+
+	template<typename T>
+	inline T HtVectorDivScalar(const T& a, float d)
+	{
+		T r;
+		const float* pa = (const float*)&a;
+		float* pr = (float*)&r;
+		for (size_t i = 0; i < sizeof(T) / sizeof(float); i++)
+		{
+			pr[i] = pa[i] / d;
+		}
+		return r;
+	}
+
+	template<typename T>
+	inline float HtVectorDot(const T& a, const T& b)
+	{
+		const float* pa = (const float*)&a;
+		const float* pb = (const float*)&b;
+		float r = pa[0] * pb[0];
+		for (size_t i = 1; i < sizeof(T) / sizeof(float); i++)
+		{
+			r += pa[i] * pb[i];
+		}
+		return r;
+	}
+
+	template<typename T>
+	inline float HtVectorMagnitude(const T& a)
+	{
+		return std::sqrt(HtVectorDot(a, a));
+	}
+
+	// Vector2/3/4的kEpsilon都是1e-5
+	template<typename T>
+	inline T HtVectorNormalize(const T& a)
+	{
+		float mag = HtVectorMagnitude(a);
+		return mag > 1e-5f ? HtVectorDivScalar(a, mag) : T{};
+	}
+
+	inline HtVector3 HtVector3Cross(const HtVector3& lhs, const HtVector3& rhs)
+	{
+		return { lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x };
+	}
+
+	inline HtQuaternion HtQuaternionMul(const HtQuaternion& lhs, const HtQuaternion& rhs)
+	{
+		return {
+			lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+			lhs.w * rhs.y + lhs.y * rhs.w + lhs.z * rhs.x - lhs.x * rhs.z,
+			lhs.w * rhs.z + lhs.z * rhs.w + lhs.x * rhs.y - lhs.y * rhs.x,
+			lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
+		};
+	}
+
+	inline HtVector3 HtQuaternionMulVector3(const HtQuaternion& rotation, const HtVector3& point)
+	{
+		float x = rotation.x * 2.0f;
+		float y = rotation.y * 2.0f;
+		float z = rotation.z * 2.0f;
+		float xx = rotation.x * x;
+		float yy = rotation.y * y;
+		float zz = rotation.z * z;
+		float xy = rotation.x * y;
+		float xz = rotation.x * z;
+		float yz = rotation.y * z;
+		float wx = rotation.w * x;
+		float wy = rotation.w * y;
+		float wz = rotation.w * z;
+		return {
+			(1.0f - (yy + zz)) * point.x + (xy - wz) * point.y + (xz + wy) * point.z,
+			(xy + wz) * point.x + (1.0f - (xx + zz)) * point.y + (yz - wx) * point.z,
+			(xz - wy) * point.x + (yz + wx) * point.y + (1.0f - (xx + yy)) * point.z,
+		};
+	}
+
 #pragma endregion
 
 }
@@ -391,14 +391,14 @@ namespace interpreter
 		16,
 		12,
 		14,
-		14,
+		18,
+		20,
 		16,
-		12,
-		14,
+		18,
 		14,
 		16,
-		14,
 		16,
+		18,
 		16,
 		14,
 		14,
@@ -643,7 +643,7 @@ namespace interpreter
 		8,
 		4,
 		2,
-		6,
+		10,
 		4,
 		2,
 		10,
@@ -662,8 +662,312 @@ namespace interpreter
 		8,
 		10,
 		12,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		10,
+		12,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		16,
+		18,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		16,
+		18,
+		14,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		18,
+		20,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		14,
+		16,
+		18,
+		6,
+		6,
+		6,
+		6,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		6,
+		6,
+		6,
+		6,
+		10,
+		10,
+		10,
+		10,
+		6,
+		6,
+		8,
+		8,
+		8,
+		6,
+		8,
+		8,
+		8,
+		6,
+		6,
+		6,
+		4,
+		8,
+		8,
+		6,
+		8,
+		8,
+		8,
+		6,
+		6,
+		6,
+		4,
+		8,
+		8,
+		6,
+		8,
+		8,
+		8,
+		6,
+		6,
+		6,
+		4,
+		8,
+		8,
+		8,
+		8,
+		2,
+		6,
 
         //!!!}}INST_SIZE
     };
+
+    HiOpcodeEnum GetCCtorFreeStaticFieldOpcode(HiOpcodeEnum op)
+    {
+        switch (op)
+        {
+        //!!!{{CCTOR_FREE_OPCODE
+        case HiOpcodeEnum::LdsfldVarVar_i1: return HiOpcodeEnum::LdsfldInitedVarVar_i1;
+        case HiOpcodeEnum::LdsfldVarVar_u1: return HiOpcodeEnum::LdsfldInitedVarVar_u1;
+        case HiOpcodeEnum::LdsfldVarVar_i2: return HiOpcodeEnum::LdsfldInitedVarVar_i2;
+        case HiOpcodeEnum::LdsfldVarVar_u2: return HiOpcodeEnum::LdsfldInitedVarVar_u2;
+        case HiOpcodeEnum::LdsfldVarVar_i4: return HiOpcodeEnum::LdsfldInitedVarVar_i4;
+        case HiOpcodeEnum::LdsfldVarVar_u4: return HiOpcodeEnum::LdsfldInitedVarVar_u4;
+        case HiOpcodeEnum::LdsfldVarVar_i8: return HiOpcodeEnum::LdsfldInitedVarVar_i8;
+        case HiOpcodeEnum::LdsfldVarVar_u8: return HiOpcodeEnum::LdsfldInitedVarVar_u8;
+        case HiOpcodeEnum::LdsfldVarVar_size_8: return HiOpcodeEnum::LdsfldInitedVarVar_size_8;
+        case HiOpcodeEnum::LdsfldVarVar_size_12: return HiOpcodeEnum::LdsfldInitedVarVar_size_12;
+        case HiOpcodeEnum::LdsfldVarVar_size_16: return HiOpcodeEnum::LdsfldInitedVarVar_size_16;
+        case HiOpcodeEnum::LdsfldVarVar_size_20: return HiOpcodeEnum::LdsfldInitedVarVar_size_20;
+        case HiOpcodeEnum::LdsfldVarVar_size_24: return HiOpcodeEnum::LdsfldInitedVarVar_size_24;
+        case HiOpcodeEnum::LdsfldVarVar_size_28: return HiOpcodeEnum::LdsfldInitedVarVar_size_28;
+        case HiOpcodeEnum::LdsfldVarVar_size_32: return HiOpcodeEnum::LdsfldInitedVarVar_size_32;
+        case HiOpcodeEnum::LdsfldVarVar_n_2: return HiOpcodeEnum::LdsfldInitedVarVar_n_2;
+        case HiOpcodeEnum::LdsfldVarVar_n_4: return HiOpcodeEnum::LdsfldInitedVarVar_n_4;
+        case HiOpcodeEnum::StsfldVarVar_i1: return HiOpcodeEnum::StsfldInitedVarVar_i1;
+        case HiOpcodeEnum::StsfldVarVar_u1: return HiOpcodeEnum::StsfldInitedVarVar_u1;
+        case HiOpcodeEnum::StsfldVarVar_i2: return HiOpcodeEnum::StsfldInitedVarVar_i2;
+        case HiOpcodeEnum::StsfldVarVar_u2: return HiOpcodeEnum::StsfldInitedVarVar_u2;
+        case HiOpcodeEnum::StsfldVarVar_i4: return HiOpcodeEnum::StsfldInitedVarVar_i4;
+        case HiOpcodeEnum::StsfldVarVar_u4: return HiOpcodeEnum::StsfldInitedVarVar_u4;
+        case HiOpcodeEnum::StsfldVarVar_i8: return HiOpcodeEnum::StsfldInitedVarVar_i8;
+        case HiOpcodeEnum::StsfldVarVar_u8: return HiOpcodeEnum::StsfldInitedVarVar_u8;
+        case HiOpcodeEnum::StsfldVarVar_size_8: return HiOpcodeEnum::StsfldInitedVarVar_size_8;
+        case HiOpcodeEnum::StsfldVarVar_size_12: return HiOpcodeEnum::StsfldInitedVarVar_size_12;
+        case HiOpcodeEnum::StsfldVarVar_size_16: return HiOpcodeEnum::StsfldInitedVarVar_size_16;
+        case HiOpcodeEnum::StsfldVarVar_size_20: return HiOpcodeEnum::StsfldInitedVarVar_size_20;
+        case HiOpcodeEnum::StsfldVarVar_size_24: return HiOpcodeEnum::StsfldInitedVarVar_size_24;
+        case HiOpcodeEnum::StsfldVarVar_size_28: return HiOpcodeEnum::StsfldInitedVarVar_size_28;
+        case HiOpcodeEnum::StsfldVarVar_size_32: return HiOpcodeEnum::StsfldInitedVarVar_size_32;
+        case HiOpcodeEnum::StsfldVarVar_n_2: return HiOpcodeEnum::StsfldInitedVarVar_n_2;
+        case HiOpcodeEnum::StsfldVarVar_n_4: return HiOpcodeEnum::StsfldInitedVarVar_n_4;
+        case HiOpcodeEnum::LdsfldaVarVar: return HiOpcodeEnum::LdsfldaInitedVarVar;
+        case HiOpcodeEnum::LdthreadlocalaVarVar: return HiOpcodeEnum::LdthreadlocalaInitedVarVar;
+        case HiOpcodeEnum::LdthreadlocalVarVar_i1: return HiOpcodeEnum::LdthreadlocalInitedVarVar_i1;
+        case HiOpcodeEnum::LdthreadlocalVarVar_u1: return HiOpcodeEnum::LdthreadlocalInitedVarVar_u1;
+        case HiOpcodeEnum::LdthreadlocalVarVar_i2: return HiOpcodeEnum::LdthreadlocalInitedVarVar_i2;
+        case HiOpcodeEnum::LdthreadlocalVarVar_u2: return HiOpcodeEnum::LdthreadlocalInitedVarVar_u2;
+        case HiOpcodeEnum::LdthreadlocalVarVar_i4: return HiOpcodeEnum::LdthreadlocalInitedVarVar_i4;
+        case HiOpcodeEnum::LdthreadlocalVarVar_u4: return HiOpcodeEnum::LdthreadlocalInitedVarVar_u4;
+        case HiOpcodeEnum::LdthreadlocalVarVar_i8: return HiOpcodeEnum::LdthreadlocalInitedVarVar_i8;
+        case HiOpcodeEnum::LdthreadlocalVarVar_u8: return HiOpcodeEnum::LdthreadlocalInitedVarVar_u8;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_8: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_8;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_12: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_12;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_16: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_16;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_20: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_20;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_24: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_24;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_28: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_28;
+        case HiOpcodeEnum::LdthreadlocalVarVar_size_32: return HiOpcodeEnum::LdthreadlocalInitedVarVar_size_32;
+        case HiOpcodeEnum::LdthreadlocalVarVar_n_2: return HiOpcodeEnum::LdthreadlocalInitedVarVar_n_2;
+        case HiOpcodeEnum::LdthreadlocalVarVar_n_4: return HiOpcodeEnum::LdthreadlocalInitedVarVar_n_4;
+        case HiOpcodeEnum::StthreadlocalVarVar_i1: return HiOpcodeEnum::StthreadlocalInitedVarVar_i1;
+        case HiOpcodeEnum::StthreadlocalVarVar_u1: return HiOpcodeEnum::StthreadlocalInitedVarVar_u1;
+        case HiOpcodeEnum::StthreadlocalVarVar_i2: return HiOpcodeEnum::StthreadlocalInitedVarVar_i2;
+        case HiOpcodeEnum::StthreadlocalVarVar_u2: return HiOpcodeEnum::StthreadlocalInitedVarVar_u2;
+        case HiOpcodeEnum::StthreadlocalVarVar_i4: return HiOpcodeEnum::StthreadlocalInitedVarVar_i4;
+        case HiOpcodeEnum::StthreadlocalVarVar_u4: return HiOpcodeEnum::StthreadlocalInitedVarVar_u4;
+        case HiOpcodeEnum::StthreadlocalVarVar_i8: return HiOpcodeEnum::StthreadlocalInitedVarVar_i8;
+        case HiOpcodeEnum::StthreadlocalVarVar_u8: return HiOpcodeEnum::StthreadlocalInitedVarVar_u8;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_8: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_8;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_12: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_12;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_16: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_16;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_20: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_20;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_24: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_24;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_28: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_28;
+        case HiOpcodeEnum::StthreadlocalVarVar_size_32: return HiOpcodeEnum::StthreadlocalInitedVarVar_size_32;
+        case HiOpcodeEnum::StthreadlocalVarVar_n_2: return HiOpcodeEnum::StthreadlocalInitedVarVar_n_2;
+        case HiOpcodeEnum::StthreadlocalVarVar_n_4: return HiOpcodeEnum::StthreadlocalInitedVarVar_n_4;
+        //!!!}}CCTOR_FREE_OPCODE
+        default: return op;
+        }
+    }
+
+    HiOpcodeEnum GetCCtorCheckedStaticFieldOpcode(HiOpcodeEnum op)
+    {
+        switch (op)
+        {
+        //!!!{{CCTOR_CHECKED_OPCODE
+        case HiOpcodeEnum::LdsfldInitedVarVar_i1: return HiOpcodeEnum::LdsfldVarVar_i1;
+        case HiOpcodeEnum::LdsfldInitedVarVar_u1: return HiOpcodeEnum::LdsfldVarVar_u1;
+        case HiOpcodeEnum::LdsfldInitedVarVar_i2: return HiOpcodeEnum::LdsfldVarVar_i2;
+        case HiOpcodeEnum::LdsfldInitedVarVar_u2: return HiOpcodeEnum::LdsfldVarVar_u2;
+        case HiOpcodeEnum::LdsfldInitedVarVar_i4: return HiOpcodeEnum::LdsfldVarVar_i4;
+        case HiOpcodeEnum::LdsfldInitedVarVar_u4: return HiOpcodeEnum::LdsfldVarVar_u4;
+        case HiOpcodeEnum::LdsfldInitedVarVar_i8: return HiOpcodeEnum::LdsfldVarVar_i8;
+        case HiOpcodeEnum::LdsfldInitedVarVar_u8: return HiOpcodeEnum::LdsfldVarVar_u8;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_8: return HiOpcodeEnum::LdsfldVarVar_size_8;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_12: return HiOpcodeEnum::LdsfldVarVar_size_12;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_16: return HiOpcodeEnum::LdsfldVarVar_size_16;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_20: return HiOpcodeEnum::LdsfldVarVar_size_20;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_24: return HiOpcodeEnum::LdsfldVarVar_size_24;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_28: return HiOpcodeEnum::LdsfldVarVar_size_28;
+        case HiOpcodeEnum::LdsfldInitedVarVar_size_32: return HiOpcodeEnum::LdsfldVarVar_size_32;
+        case HiOpcodeEnum::LdsfldInitedVarVar_n_2: return HiOpcodeEnum::LdsfldVarVar_n_2;
+        case HiOpcodeEnum::LdsfldInitedVarVar_n_4: return HiOpcodeEnum::LdsfldVarVar_n_4;
+        case HiOpcodeEnum::StsfldInitedVarVar_i1: return HiOpcodeEnum::StsfldVarVar_i1;
+        case HiOpcodeEnum::StsfldInitedVarVar_u1: return HiOpcodeEnum::StsfldVarVar_u1;
+        case HiOpcodeEnum::StsfldInitedVarVar_i2: return HiOpcodeEnum::StsfldVarVar_i2;
+        case HiOpcodeEnum::StsfldInitedVarVar_u2: return HiOpcodeEnum::StsfldVarVar_u2;
+        case HiOpcodeEnum::StsfldInitedVarVar_i4: return HiOpcodeEnum::StsfldVarVar_i4;
+        case HiOpcodeEnum::StsfldInitedVarVar_u4: return HiOpcodeEnum::StsfldVarVar_u4;
+        case HiOpcodeEnum::StsfldInitedVarVar_i8: return HiOpcodeEnum::StsfldVarVar_i8;
+        case HiOpcodeEnum::StsfldInitedVarVar_u8: return HiOpcodeEnum::StsfldVarVar_u8;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_8: return HiOpcodeEnum::StsfldVarVar_size_8;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_12: return HiOpcodeEnum::StsfldVarVar_size_12;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_16: return HiOpcodeEnum::StsfldVarVar_size_16;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_20: return HiOpcodeEnum::StsfldVarVar_size_20;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_24: return HiOpcodeEnum::StsfldVarVar_size_24;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_28: return HiOpcodeEnum::StsfldVarVar_size_28;
+        case HiOpcodeEnum::StsfldInitedVarVar_size_32: return HiOpcodeEnum::StsfldVarVar_size_32;
+        case HiOpcodeEnum::StsfldInitedVarVar_n_2: return HiOpcodeEnum::StsfldVarVar_n_2;
+        case HiOpcodeEnum::StsfldInitedVarVar_n_4: return HiOpcodeEnum::StsfldVarVar_n_4;
+        case HiOpcodeEnum::LdsfldaInitedVarVar: return HiOpcodeEnum::LdsfldaVarVar;
+        case HiOpcodeEnum::LdthreadlocalaInitedVarVar: return HiOpcodeEnum::LdthreadlocalaVarVar;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_i1: return HiOpcodeEnum::LdthreadlocalVarVar_i1;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_u1: return HiOpcodeEnum::LdthreadlocalVarVar_u1;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_i2: return HiOpcodeEnum::LdthreadlocalVarVar_i2;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_u2: return HiOpcodeEnum::LdthreadlocalVarVar_u2;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_i4: return HiOpcodeEnum::LdthreadlocalVarVar_i4;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_u4: return HiOpcodeEnum::LdthreadlocalVarVar_u4;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_i8: return HiOpcodeEnum::LdthreadlocalVarVar_i8;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_u8: return HiOpcodeEnum::LdthreadlocalVarVar_u8;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_8: return HiOpcodeEnum::LdthreadlocalVarVar_size_8;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_12: return HiOpcodeEnum::LdthreadlocalVarVar_size_12;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_16: return HiOpcodeEnum::LdthreadlocalVarVar_size_16;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_20: return HiOpcodeEnum::LdthreadlocalVarVar_size_20;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_24: return HiOpcodeEnum::LdthreadlocalVarVar_size_24;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_28: return HiOpcodeEnum::LdthreadlocalVarVar_size_28;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_32: return HiOpcodeEnum::LdthreadlocalVarVar_size_32;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_n_2: return HiOpcodeEnum::LdthreadlocalVarVar_n_2;
+        case HiOpcodeEnum::LdthreadlocalInitedVarVar_n_4: return HiOpcodeEnum::LdthreadlocalVarVar_n_4;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_i1: return HiOpcodeEnum::StthreadlocalVarVar_i1;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_u1: return HiOpcodeEnum::StthreadlocalVarVar_u1;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_i2: return HiOpcodeEnum::StthreadlocalVarVar_i2;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_u2: return HiOpcodeEnum::StthreadlocalVarVar_u2;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_i4: return HiOpcodeEnum::StthreadlocalVarVar_i4;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_u4: return HiOpcodeEnum::StthreadlocalVarVar_u4;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_i8: return HiOpcodeEnum::StthreadlocalVarVar_i8;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_u8: return HiOpcodeEnum::StthreadlocalVarVar_u8;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_8: return HiOpcodeEnum::StthreadlocalVarVar_size_8;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_12: return HiOpcodeEnum::StthreadlocalVarVar_size_12;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_16: return HiOpcodeEnum::StthreadlocalVarVar_size_16;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_20: return HiOpcodeEnum::StthreadlocalVarVar_size_20;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_24: return HiOpcodeEnum::StthreadlocalVarVar_size_24;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_28: return HiOpcodeEnum::StthreadlocalVarVar_size_28;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_size_32: return HiOpcodeEnum::StthreadlocalVarVar_size_32;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_n_2: return HiOpcodeEnum::StthreadlocalVarVar_n_2;
+        case HiOpcodeEnum::StthreadlocalInitedVarVar_n_4: return HiOpcodeEnum::StthreadlocalVarVar_n_4;
+        //!!!}}CCTOR_CHECKED_OPCODE
+        default: return op;
+        }
+    }
 }
 }
\ No newline at end of file
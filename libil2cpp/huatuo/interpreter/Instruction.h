@@ -678,10 +678,159 @@ namespace interpreter
 		NewVector2VarVarVar,
 		NewVector3VarVarVarVar,
 		NewVector4VarVarVarVarVar,
+		BranchVarArrayLength_Clt_i4,
+		BranchVarArrayLength_Cge_i4,
+		BinOpVarVarFld_Add_i4,
+		BinOpVarVarFld_Add_i8,
+		BinOpVarVarFld_Add_f4,
+		BinOpVarVarFld_Add_f8,
+		BinOpVarVarFld_Sub_i4,
+		BinOpVarVarFld_Sub_i8,
+		BinOpVarVarFld_Sub_f4,
+		BinOpVarVarFld_Sub_f8,
+		BinOpVarVarFld_Mul_i4,
+		BinOpVarVarFld_Mul_i8,
+		BinOpVarVarFld_Mul_f4,
+		BinOpVarVarFld_Mul_f8,
+		LdftnVar,
+		LdsfldInitedVarVar_i1,
+		LdsfldInitedVarVar_u1,
+		LdsfldInitedVarVar_i2,
+		LdsfldInitedVarVar_u2,
+		LdsfldInitedVarVar_i4,
+		LdsfldInitedVarVar_u4,
+		LdsfldInitedVarVar_i8,
+		LdsfldInitedVarVar_u8,
+		LdsfldInitedVarVar_size_8,
+		LdsfldInitedVarVar_size_12,
+		LdsfldInitedVarVar_size_16,
+		LdsfldInitedVarVar_size_20,
+		LdsfldInitedVarVar_size_24,
+		LdsfldInitedVarVar_size_28,
+		LdsfldInitedVarVar_size_32,
+		LdsfldInitedVarVar_n_2,
+		LdsfldInitedVarVar_n_4,
+		StsfldInitedVarVar_i1,
+		StsfldInitedVarVar_u1,
+		StsfldInitedVarVar_i2,
+		StsfldInitedVarVar_u2,
+		StsfldInitedVarVar_i4,
+		StsfldInitedVarVar_u4,
+		StsfldInitedVarVar_i8,
+		StsfldInitedVarVar_u8,
+		StsfldInitedVarVar_size_8,
+		StsfldInitedVarVar_size_12,
+		StsfldInitedVarVar_size_16,
+		StsfldInitedVarVar_size_20,
+		StsfldInitedVarVar_size_24,
+		StsfldInitedVarVar_size_28,
+		StsfldInitedVarVar_size_32,
+		StsfldInitedVarVar_n_2,
+		StsfldInitedVarVar_n_4,
+		LdsfldaInitedVarVar,
+		LdthreadlocalaInitedVarVar,
+		LdthreadlocalInitedVarVar_i1,
+		LdthreadlocalInitedVarVar_u1,
+		LdthreadlocalInitedVarVar_i2,
+		LdthreadlocalInitedVarVar_u2,
+		LdthreadlocalInitedVarVar_i4,
+		LdthreadlocalInitedVarVar_u4,
+		LdthreadlocalInitedVarVar_i8,
+		LdthreadlocalInitedVarVar_u8,
+		LdthreadlocalInitedVarVar_size_8,
+		LdthreadlocalInitedVarVar_size_12,
+		LdthreadlocalInitedVarVar_size_16,
+		LdthreadlocalInitedVarVar_size_20,
+		LdthreadlocalInitedVarVar_size_24,
+		LdthreadlocalInitedVarVar_size_28,
+		LdthreadlocalInitedVarVar_size_32,
+		LdthreadlocalInitedVarVar_n_2,
+		LdthreadlocalInitedVarVar_n_4,
+		StthreadlocalInitedVarVar_i1,
+		StthreadlocalInitedVarVar_u1,
+		StthreadlocalInitedVarVar_i2,
+		StthreadlocalInitedVarVar_u2,
+		StthreadlocalInitedVarVar_i4,
+		StthreadlocalInitedVarVar_u4,
+		StthreadlocalInitedVarVar_i8,
+		StthreadlocalInitedVarVar_u8,
+		StthreadlocalInitedVarVar_size_8,
+		StthreadlocalInitedVarVar_size_12,
+		StthreadlocalInitedVarVar_size_16,
+		StthreadlocalInitedVarVar_size_20,
+		StthreadlocalInitedVarVar_size_24,
+		StthreadlocalInitedVarVar_size_28,
+		StthreadlocalInitedVarVar_size_32,
+		StthreadlocalInitedVarVar_n_2,
+		StthreadlocalInitedVarVar_n_4,
+		MathAbsVarVar_i4,
+		MathAbsVarVar_i8,
+		MathAbsVarVar_f4,
+		MathAbsVarVar_f8,
+		MathMinVarVarVar_i4,
+		MathMinVarVarVar_i8,
+		MathMinVarVarVar_f4,
+		MathMinVarVarVar_f8,
+		MathMaxVarVarVar_i4,
+		MathMaxVarVarVar_i8,
+		MathMaxVarVarVar_f4,
+		MathMaxVarVarVar_f8,
+		MathSqrtVarVar_f4,
+		MathSqrtVarVar_f8,
+		MathFloorVarVar_f4,
+		MathFloorVarVar_f8,
+		MathClampVarVarVarVar_i4,
+		MathClampVarVarVarVar_i8,
+		MathClampVarVarVarVar_f4,
+		MathClampVarVarVarVar_f8,
+		ArrayGetLengthVarVar,
+		StringGetLengthVarVar,
+		StringGetCharsVarVarVar,
+		Vector2AddVarVarVar,
+		Vector2SubVarVarVar,
+		Vector2NegVarVar,
+		Vector2MulScalarVarVarVar,
+		Vector2DivScalarVarVarVar,
+		Vector2DotVarVarVar,
+		Vector2MagnitudeVarVar,
+		Vector2SqrMagnitudeVarVar,
+		Vector2NormalizedVarVar,
+		Vector2NormalizeVar,
+		Vector3AddVarVarVar,
+		Vector3SubVarVarVar,
+		Vector3NegVarVar,
+		Vector3MulScalarVarVarVar,
+		Vector3DivScalarVarVarVar,
+		Vector3DotVarVarVar,
+		Vector3MagnitudeVarVar,
+		Vector3SqrMagnitudeVarVar,
+		Vector3NormalizedVarVar,
+		Vector3NormalizeVar,
+		Vector4AddVarVarVar,
+		Vector4SubVarVarVar,
+		Vector4NegVarVar,
+		Vector4MulScalarVarVarVar,
+		Vector4DivScalarVarVarVar,
+		Vector4DotVarVarVar,
+		Vector4MagnitudeVarVar,
+		Vector4SqrMagnitudeVarVar,
+		Vector4NormalizedVarVar,
+		Vector4NormalizeVar,
+		Vector3CrossVarVarVar,
+		QuaternionMulVarVarVar,
+		QuaternionMulVector3VarVarVar,
+		QuaternionDotVarVarVar,
+		TierUpLoopHeader,
+		OsrLoopHeader,
 
 		//!!!}}OPCODE
+		__Count,
 	};
 
+	// 访问静态字段的指令与其不检查类构造函数的版本互相转换,其他指令返回原值
+	HiOpcodeEnum GetCCtorFreeStaticFieldOpcode(HiOpcodeEnum op);
+	HiOpcodeEnum GetCCtorCheckedStaticFieldOpcode(HiOpcodeEnum op);
+
 	struct IRCommon
 	{
 		HiOpcodeEnum type;
@@ -3505,6 +3654,7 @@ namespace interpreter
 		uint32_t managed2NativeMethod;
 		uint32_t methodInfo;
 		uint32_t argIdxs;
+		uint32_t inlineCache;
 	};
 
 
@@ -3514,6 +3664,7 @@ namespace interpreter
 		uint32_t methodInfo;
 		uint32_t argIdxs;
 		uint16_t ret;
+		uint32_t inlineCache;
 	};
 
 
@@ -3521,6 +3672,7 @@ namespace interpreter
 	{
 		MethodInfo* method;
 		uint16_t argBase;
+		uint32_t inlineCache;
 	};
 
 
@@ -3529,6 +3681,7 @@ namespace interpreter
 		MethodInfo* method;
 		uint16_t argBase;
 		uint16_t ret;
+		uint32_t inlineCache;
 	};
 
 
@@ -3554,6 +3707,7 @@ namespace interpreter
 		uint32_t managed2NativeStaticMethod;
 		uint32_t managed2NativeInstanceMethod;
 		uint32_t argIdxs;
+		uint16_t invokeState;
 	};
 
 
@@ -3563,6 +3717,7 @@ namespace interpreter
 		uint32_t managed2NativeInstanceMethod;
 		uint32_t argIdxs;
 		uint16_t ret;
+		uint16_t invokeState;
 	};
 
 
@@ -5478,6 +5633,7 @@ namespace interpreter
 	struct IRLeaveEx : IRCommon
 	{
 		int32_t offset;
+		int32_t finallyIndex;
 	};
 
 
@@ -5626,6 +5782,1148 @@ namespace interpreter
 	};
 
 
+	struct IRBranchVarArrayLength_Clt_i4 : IRCommon
+	{
+		uint16_t op;
+		uint16_t arr;
+		int32_t offset;
+	};
+
+
+	struct IRBranchVarArrayLength_Cge_i4 : IRCommon
+	{
+		uint16_t op;
+		uint16_t arr;
+		int32_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Add_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Add_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Add_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Add_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Sub_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Sub_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Sub_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Sub_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Mul_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Mul_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Mul_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRBinOpVarVarFld_Mul_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRLdftnVar : IRCommon
+	{
+		uint16_t dst;
+		MethodInfo* method;
+	};
+
+
+	struct IRLdsfldInitedVarVar_i1 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_u1 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_i2 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_u2 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_i4 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_u4 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_i8 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_u8 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_8 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_12 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_16 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_20 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_24 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_28 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_size_32 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdsfldInitedVarVar_n_2 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t size;
+	};
+
+
+	struct IRLdsfldInitedVarVar_n_4 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint32_t size;
+	};
+
+
+	struct IRStsfldInitedVarVar_i1 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_u1 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_i2 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_u2 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_i4 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_u4 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_i8 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_u8 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_8 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_12 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_16 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_20 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_24 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_28 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_size_32 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStsfldInitedVarVar_n_2 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+		uint16_t size;
+	};
+
+
+	struct IRStsfldInitedVarVar_n_4 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+		uint32_t size;
+	};
+
+
+	struct IRLdsfldaInitedVarVar : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		uint16_t offset;
+	};
+
+
+	struct IRLdthreadlocalaInitedVarVar : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_i1 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_u1 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_i2 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_u2 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_i4 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_u4 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_i8 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_u8 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_8 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_12 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_16 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_20 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_24 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_28 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_size_32 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_n_2 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+		uint16_t size;
+	};
+
+
+	struct IRLdthreadlocalInitedVarVar_n_4 : IRCommon
+	{
+		uint16_t dst;
+		Il2CppClass* klass;
+		int32_t offset;
+		uint32_t size;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_i1 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_u1 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_i2 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_u2 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_i4 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_u4 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_i8 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_u8 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_8 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_12 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_16 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_20 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_24 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_28 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_size_32 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_n_2 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+		uint16_t size;
+	};
+
+
+	struct IRStthreadlocalInitedVarVar_n_4 : IRCommon
+	{
+		Il2CppClass* klass;
+		uint16_t offset;
+		uint16_t data;
+		uint32_t size;
+	};
+
+
+	struct IRMathAbsVarVar_i4 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathAbsVarVar_i8 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathAbsVarVar_f4 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathAbsVarVar_f8 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathMinVarVarVar_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMinVarVarVar_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMinVarVarVar_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMinVarVarVar_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMaxVarVarVar_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMaxVarVarVar_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMaxVarVarVar_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathMaxVarVarVar_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRMathSqrtVarVar_f4 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathSqrtVarVar_f8 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathFloorVarVar_f4 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathFloorVarVar_f8 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRMathClampVarVarVarVar_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t value;
+		uint16_t min;
+		uint16_t max;
+	};
+
+
+	struct IRMathClampVarVarVarVar_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t value;
+		uint16_t min;
+		uint16_t max;
+	};
+
+
+	struct IRMathClampVarVarVarVar_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t value;
+		uint16_t min;
+		uint16_t max;
+	};
+
+
+	struct IRMathClampVarVarVarVar_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t value;
+		uint16_t min;
+		uint16_t max;
+	};
+
+
+	struct IRArrayGetLengthVarVar : IRCommon
+	{
+		uint16_t len;
+		uint16_t arr;
+	};
+
+
+	struct IRStringGetLengthVarVar : IRCommon
+	{
+		uint16_t len;
+		uint16_t str;
+	};
+
+
+	struct IRStringGetCharsVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t str;
+		uint16_t index;
+	};
+
+
+	struct IRVector2AddVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector2SubVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector2NegVarVar : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRVector2MulScalarVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t vec;
+		uint16_t scalar;
+	};
+
+
+	struct IRVector2DivScalarVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t vec;
+		uint16_t scalar;
+	};
+
+
+	struct IRVector2DotVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector2MagnitudeVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector2SqrMagnitudeVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector2NormalizedVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector2NormalizeVar : IRCommon
+	{
+		uint16_t self;
+	};
+
+
+	struct IRVector3AddVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector3SubVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector3NegVarVar : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRVector3MulScalarVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t vec;
+		uint16_t scalar;
+	};
+
+
+	struct IRVector3DivScalarVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t vec;
+		uint16_t scalar;
+	};
+
+
+	struct IRVector3DotVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector3MagnitudeVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector3SqrMagnitudeVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector3NormalizedVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector3NormalizeVar : IRCommon
+	{
+		uint16_t self;
+	};
+
+
+	struct IRVector4AddVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector4SubVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector4NegVarVar : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+	};
+
+
+	struct IRVector4MulScalarVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t vec;
+		uint16_t scalar;
+	};
+
+
+	struct IRVector4DivScalarVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t vec;
+		uint16_t scalar;
+	};
+
+
+	struct IRVector4DotVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRVector4MagnitudeVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector4SqrMagnitudeVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector4NormalizedVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t self;
+	};
+
+
+	struct IRVector4NormalizeVar : IRCommon
+	{
+		uint16_t self;
+	};
+
+
+	struct IRVector3CrossVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRQuaternionMulVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRQuaternionMulVector3VarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t rotation;
+		uint16_t point;
+	};
+
+
+	struct IRQuaternionDotVarVarVar : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint16_t op2;
+	};
+
+
+	struct IRTierUpLoopHeader : IRCommon
+	{
+	};
+
+
+	struct IROsrLoopHeader : IRCommon
+	{
+		int32_t ilOffset;
+	};
+
+
 	//!!!}}INST
 #pragma pack(pop)
 
@@ -45,6 +45,27 @@ namespace interpreter
 		uint32_t stackObjectSize; //
 	};
 
+	// 虚函数调用点的内联缓存,存放在resolveDatas中。表项为空时才填充,填充后不再修改,
+	// 因此多线程读写无需加锁。表满后未命中的类型每次都走慢速查找。
+	struct VirtualCallInlineCache
+	{
+		struct Entry
+		{
+			Il2CppClass* klass;
+			MethodInfo* method;
+		};
+		Entry entries[2];
+	};
+
+	const int32_t kVirtualCallInlineCacheSlotCount = (int32_t)(sizeof(VirtualCallInlineCache) / sizeof(void*));
+
+	// 可以栈上替换进入的循环头
+	struct InterpOsrEntry
+	{
+		int32_t ilOffset;
+		int32_t irOffset;
+	};
+
 	struct InterpMethodInfo
 	{
 		const MethodInfo* method;
@@ -58,8 +79,18 @@ namespace interpreter
 		uint32_t evalStackBaseOffset;
 		uint32_t localStackSize; // args + locals StackObject size
 		std::vector<const void*> resolveDatas;
-		std::vector<InterpExceptionClause*> exClauses;
+		InterpExceptionClause* exClauses;
+		uint32_t exClauseCount;
+		int32_t* leaveFinallyClauseIndexes; // 每个leave指令依次执行的finally在exClauses中的索引,以-1结尾
+		uint32_t leaveFinallyClauseIndexCount;
+		InterpOsrEntry* osrEntries; // 只有优化版本有,按ilOffset排序
+		uint32_t osrEntryCount;
+		// 基础版本的调用次数和循环回跳次数,达到阈值时重新优化转换。多线程下允许少计
+		mutable uint32_t invokeCount;
+		mutable uint32_t backEdgeCount;
+		mutable bool tierUpFailed;
 		uint32_t isTrivialCopyArgs : 1;
+		uint32_t isOptimized : 1;
 	};
 
 	class Interpreter
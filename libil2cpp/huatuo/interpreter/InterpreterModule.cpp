@@ -12,6 +12,8 @@
 #include "../metadata/MetadataModule.h"
 #include "../metadata/MetadataUtil.h"
 #include "../transform/Transform.h"
+#include "../transform/Intrinsics.h"
+#include "../transform/TransformCache.h"
 
 
 
@@ -21,9 +23,19 @@ namespace huatuo
 namespace interpreter
 {
 	il2cpp::os::ThreadLocalValue InterpreterModule::s_machineState;
+	uint32_t InterpreterModule::s_tierUpInvokeThreshold = HUATUO_TIER_UP_INVOKE_THRESHOLD;
+	uint32_t InterpreterModule::s_tierUpBackEdgeThreshold = HUATUO_TIER_UP_BACK_EDGE_THRESHOLD;
 
 	static std::unordered_map<const char*, NativeCallMethod, CStringHash, CStringEqualTo> s_calls;
 	static std::unordered_map<const char*, NativeInvokeMethod, CStringHash, CStringEqualTo> s_invokes;
+	static std::unordered_map<Managed2NativeCallMethod, const char*> s_managed2NativeSignatures;
+
+	typedef uint64_t SignatureKey;
+	static SignatureKey ParseSignatureKey(const char* signature);
+
+	// 以下两个表只在Initialize中写入,之后只读
+	static std::unordered_map<SignatureKey, const NativeCallMethod*> s_callsByKey;
+	static std::unordered_map<SignatureKey, const NativeInvokeMethod*> s_invokesByKey;
 
 
 	void InterpreterModule::Initialize()
@@ -36,6 +48,15 @@ namespace interpreter
 				break;
 			}
 			s_calls.insert({ method.signature, method });
+			s_managed2NativeSignatures.insert({ method.managed2NativeMethod, method.signature });
+		}
+		for (auto& e : s_calls)
+		{
+			SignatureKey key = ParseSignatureKey(e.first);
+			if (key)
+			{
+				s_callsByKey.insert({ key, &e.second });
+			}
 		}
 
 		for (size_t i = 0; ; i++)
@@ -47,6 +68,17 @@ namespace interpreter
 			}
 			s_invokes.insert({ method.signature, method });
 		}
+		for (auto& e : s_invokes)
+		{
+			SignatureKey key = ParseSignatureKey(e.first);
+			if (key)
+			{
+				s_invokesByKey.insert({ key, &e.second });
+			}
+		}
+
+		transform::Intrinsics::Initialize();
+		MachineState::RegisterGCRootProvider();
 	}
 
 	void AppendString(char* sigBuf, size_t bufSize, size_t& pos, const char* str)
@@ -63,30 +95,36 @@ namespace interpreter
 		}
 	}
 
-	void AppendSignature(const Il2CppType* type, bool returnType, char* sigBuf, size_t bufferSize, size_t& pos)
+	enum class SignatureTypeKind
 	{
+		Void = 1,
+		Int = 2,
+		Float = 3,
+		Struct = 4,
+	};
+
+	// 桥接函数签名中一个类型的编码。参数只区分整数和浮点,返回值为超过8字节的值类型时按8字节个数区分
+	static SignatureTypeKind GetSignatureTypeKind(const Il2CppType* type, bool returnType, int32_t& structSlotCount)
+	{
+		structSlotCount = 0;
 		if (type->byref)
 		{
-			AppendString(sigBuf, bufferSize, pos, "i");
-			return;
+			return SignatureTypeKind::Int;
 		}
 		switch (type->type)
 		{
-		case IL2CPP_TYPE_VOID: AppendString(sigBuf, bufferSize, pos, "v"); break;
+		case IL2CPP_TYPE_VOID: return SignatureTypeKind::Void;
 		case IL2CPP_TYPE_R4:
-		case IL2CPP_TYPE_R8: AppendString(sigBuf, bufferSize, pos, "f"); break;
+		case IL2CPP_TYPE_R8: return SignatureTypeKind::Float;
 		case IL2CPP_TYPE_TYPEDBYREF:
 		{
 			if (returnType)
 			{
 				IL2CPP_ASSERT(sizeof(Il2CppTypedRef) == 24);
-				AppendString(sigBuf, bufferSize, pos, "s3");
-			}
-			else
-			{
-				AppendString(sigBuf, bufferSize, pos, "i");
+				structSlotCount = 3;
+				return SignatureTypeKind::Struct;
 			}
-			break;
+			return SignatureTypeKind::Int;
 		}
 		case IL2CPP_TYPE_VALUETYPE:
 		{
@@ -94,20 +132,13 @@ namespace interpreter
 			{
 				Il2CppClass* klass = il2cpp::vm::Class::FromIl2CppType(type);
 				il2cpp::vm::Class::SetupFields(klass);
-				if (klass->instance_size <= sizeof(Il2CppObject) + 8)
-				{
-					AppendString(sigBuf, bufferSize, pos, "i");
-				}
-				else
+				if (klass->instance_size > sizeof(Il2CppObject) + 8)
 				{
-					pos += std::sprintf(sigBuf + pos, "s%d", (int)((klass->instance_size - sizeof(Il2CppObject) + 7) / 8));
+					structSlotCount = (int32_t)((klass->instance_size - sizeof(Il2CppObject) + 7) / 8);
+					return SignatureTypeKind::Struct;
 				}
 			}
-			else
-			{
-				AppendString(sigBuf, bufferSize, pos, "i");
-			}
-			break;
+			return SignatureTypeKind::Int;
 		}
 		case IL2CPP_TYPE_GENERICINST:
 		{
@@ -116,21 +147,135 @@ namespace interpreter
 				Il2CppClass* klass = il2cpp::vm::Class::FromIl2CppType(type);
 				if (klass->valuetype && klass->instance_size > sizeof(Il2CppObject) + 8)
 				{
-					pos += std::sprintf(sigBuf + pos, "s%d", (int)(klass->instance_size - sizeof(Il2CppObject) + 7) / 8);
-				}
-				else
-				{
-					AppendString(sigBuf, bufferSize, pos, "i");
+					structSlotCount = (int32_t)((klass->instance_size - sizeof(Il2CppObject) + 7) / 8);
+					return SignatureTypeKind::Struct;
 				}
 			}
-			else
+			return SignatureTypeKind::Int;
+		}
+		default: return SignatureTypeKind::Int;
+		}
+	}
+
+	void AppendSignature(const Il2CppType* type, bool returnType, char* sigBuf, size_t bufferSize, size_t& pos)
+	{
+		int32_t structSlotCount;
+		switch (GetSignatureTypeKind(type, returnType, structSlotCount))
+		{
+		case SignatureTypeKind::Void: AppendString(sigBuf, bufferSize, pos, "v"); break;
+		case SignatureTypeKind::Float: AppendString(sigBuf, bufferSize, pos, "f"); break;
+		case SignatureTypeKind::Struct: pos += std::sprintf(sigBuf + pos, "s%d", structSlotCount); break;
+		default: AppendString(sigBuf, bufferSize, pos, "i"); break;
+		}
+	}
+
+	// 签名的紧凑编码,查找桥接函数时不必拼接字符串和计算字符串hash。
+	// [0,3)返回类型, [3,11)返回值的8字节个数, [11,17)参数个数(含this), 之后每个参数1位,浮点为1。
+	// 参数过多或返回值过大无法编码时为0,退回按字符串签名查找。
+	const uint32_t kSignatureKeyParamBitBegin = 17;
+	const uint32_t kMaxSignatureKeyParamCount = 64 - kSignatureKeyParamBitBegin;
+	const int32_t kMaxSignatureKeyStructSlotCount = 0xFF;
+
+	static SignatureKey MakeSignatureKeyHeader(SignatureTypeKind retKind, int32_t structSlotCount, uint32_t paramCount)
+	{
+		if (paramCount > kMaxSignatureKeyParamCount || structSlotCount > kMaxSignatureKeyStructSlotCount)
+		{
+			return 0;
+		}
+		return (SignatureKey)retKind | ((SignatureKey)structSlotCount << 3) | ((SignatureKey)paramCount << 11);
+	}
+
+	static SignatureKey MakeFloatParamBit(uint32_t paramIndex)
+	{
+		return (SignatureKey)1 << (kSignatureKeyParamBitBegin + paramIndex);
+	}
+
+	template<typename GetParamType>
+	static SignatureKey ComputeSignatureKey(const Il2CppType* ret, bool instanceCall, uint32_t paramCount, GetParamType getParamType)
+	{
+		int32_t structSlotCount;
+		SignatureTypeKind retKind = GetSignatureTypeKind(ret, true, structSlotCount);
+		SignatureKey key = MakeSignatureKeyHeader(retKind, structSlotCount, paramCount + instanceCall);
+		if (key == 0)
+		{
+			return 0;
+		}
+		for (uint32_t i = 0; i < paramCount; i++)
+		{
+			if (GetSignatureTypeKind(getParamType(i), false, structSlotCount) == SignatureTypeKind::Float)
 			{
-				AppendString(sigBuf, bufferSize, pos, "i");
+				key |= MakeFloatParamBit(i + instanceCall);
+			}
+		}
+		return key;
+	}
+
+	static SignatureKey ComputeSignatureKey(const MethodInfo* method, bool call)
+	{
+		return ComputeSignatureKey(method->return_type, call && metadata::IsInstanceMethod(method), method->parameters_count,
+			[method](uint32_t i) { return method->parameters[i].parameter_type; });
+	}
+
+	static SignatureKey ComputeSignatureKey(const Il2CppMethodDefinition* method, bool call)
+	{
+		const Il2CppImage* image = huatuo::metadata::MetadataModule::GetImage(method)->GetIl2CppImage();
+		return ComputeSignatureKey(huatuo::metadata::MetadataModule::GetIl2CppTypeFromEncodeIndex(method->returnType), call && metadata::IsInstanceMethod(method), method->parameterCount,
+			[image, method](uint32_t i)
+			{
+				TypeIndex paramTypeIndex = huatuo::metadata::MetadataModule::GetParameterDefinitionFromIndex(image, method->parameterStart + i)->typeIndex;
+				return huatuo::metadata::MetadataModule::GetIl2CppTypeFromEncodeIndex(paramTypeIndex);
+			});
+	}
+
+	static SignatureKey ComputeSignatureKey(const metadata::ResolveStandAloneMethodSig& methodSig)
+	{
+		return ComputeSignatureKey(&methodSig.returnType, false, methodSig.paramCount,
+			[&methodSig](uint32_t i) { return (const Il2CppType*)(methodSig.params + i); });
+	}
+
+	// 解析桥接函数表中的字符串签名,格式与AppendSignature生成的一致
+	static SignatureKey ParseSignatureKey(const char* signature)
+	{
+		SignatureTypeKind retKind;
+		int32_t structSlotCount = 0;
+		switch (*signature++)
+		{
+		case 'v': retKind = SignatureTypeKind::Void; break;
+		case 'i': retKind = SignatureTypeKind::Int; break;
+		case 'f': retKind = SignatureTypeKind::Float; break;
+		case 's':
+		{
+			retKind = SignatureTypeKind::Struct;
+			while (*signature >= '0' && *signature <= '9')
+			{
+				structSlotCount = structSlotCount * 10 + (*signature++ - '0');
+				if (structSlotCount > kMaxSignatureKeyStructSlotCount)
+				{
+					return 0;
+				}
 			}
 			break;
 		}
-		default: AppendString(sigBuf, bufferSize, pos, "i"); break;
+		default: return 0;
 		}
+		SignatureKey floatParamBits = 0;
+		uint32_t paramCount = 0;
+		for (; *signature; signature++, paramCount++)
+		{
+			if (paramCount >= kMaxSignatureKeyParamCount)
+			{
+				return 0;
+			}
+			if (*signature == 'f')
+			{
+				floatParamBits |= MakeFloatParamBit(paramCount);
+			}
+			else if (*signature != 'i')
+			{
+				return 0;
+			}
+		}
+		return MakeSignatureKeyHeader(retKind, structSlotCount, paramCount) | floatParamBits;
 	}
 
 	bool InterpreterModule::ComputSignature(const Il2CppType* ret, const Il2CppType* params, uint32_t paramCount, bool instanceCall, char* sigBuf, size_t bufferSize)
@@ -195,6 +340,12 @@ namespace interpreter
 	template<typename T>
 	const NativeCallMethod* GetNativeCallMethod(const T* method, bool forceStatic)
 	{
+		SignatureKey key = ComputeSignatureKey(method, !forceStatic);
+		if (key)
+		{
+			auto it = s_callsByKey.find(key);
+			return (it != s_callsByKey.end()) ? it->second : nullptr;
+		}
 		char sigName[1000];
 		InterpreterModule::ComputSignature(method, !forceStatic, sigName, sizeof(sigName) - 1);
 		auto it = s_calls.find(sigName);
@@ -204,6 +355,12 @@ namespace interpreter
 	template<typename T>
 	const NativeInvokeMethod* GetNativeInvokeMethod(const T* method)
 	{
+		SignatureKey key = ComputeSignatureKey(method, false);
+		if (key)
+		{
+			auto it = s_invokesByKey.find(key);
+			return (it != s_invokesByKey.end()) ? it->second : nullptr;
+		}
 		char sigName[1000];
 		InterpreterModule::ComputSignature(method, false, sigName, sizeof(sigName) - 1);
 		auto it = s_invokes.find(sigName);
@@ -281,6 +438,12 @@ namespace interpreter
 
 	Managed2NativeCallMethod InterpreterModule::GetManaged2NativeMethodPointer(const metadata::ResolveStandAloneMethodSig& method)
 	{
+		SignatureKey key = ComputeSignatureKey(method);
+		if (key)
+		{
+			auto it = s_callsByKey.find(key);
+			return it != s_callsByKey.end() ? it->second->managed2NativeMethod : NotSupportManaged2Native;
+		}
 		char sigName[1000];
 		ComputSignature(&method.returnType, method.params, method.paramCount, false, sigName, sizeof(sigName) - 1);
 		auto it = s_calls.find(sigName);
@@ -291,6 +454,18 @@ namespace interpreter
 		return NotSupportManaged2Native;
 	}
 
+	Managed2NativeCallMethod InterpreterModule::GetManaged2NativeMethodPointer(const char* signature)
+	{
+		auto it = s_calls.find(signature);
+		return it != s_calls.end() ? it->second.managed2NativeMethod : nullptr;
+	}
+
+	const char* InterpreterModule::GetManaged2NativeMethodSignature(Managed2NativeCallMethod method)
+	{
+		auto it = s_managed2NativeSignatures.find(method);
+		return it != s_managed2NativeSignatures.end() ? it->second : nullptr;
+	}
+
 	static void* NotSupportInvoke(Il2CppMethodPointer, const MethodInfo*, void*, void**)
 	{
 		il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetTypeInitializationException("", nullptr));
@@ -317,24 +492,92 @@ namespace interpreter
 		return NotSupportInvoke;
 	}
 
-	InterpMethodInfo* InterpreterModule::GetInterpMethodInfo(metadata::Image* image, const MethodInfo* methodInfo)
+	static void FreeInterpMethodInfo(InterpMethodInfo* imi)
 	{
-		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		IL2CPP_FREE(imi->args);
+		IL2CPP_FREE((void*)imi->codes);
+		IL2CPP_FREE(imi->exClauses);
+		IL2CPP_FREE(imi->leaveFinallyClauseIndexes);
+		IL2CPP_FREE(imi->osrEntries);
+		imi->~InterpMethodInfo();
+		IL2CPP_FREE(imi);
+	}
 
-		if (methodInfo->huatuoData)
+	// 转换不持有g_MetadataLock,只有Image内部解析token等短临界区加锁。
+	// 多个线程可能同时转换同一函数,CAS安装第一个完成的结果,其余的丢弃。
+	InterpMethodInfo* InterpreterModule::GetInterpMethodInfo(metadata::Image* image, const MethodInfo* methodInfo)
+	{
+		InterpMethodInfo* imi = (InterpMethodInfo*)il2cpp::os::Atomic::ReadPointer(&const_cast<MethodInfo*>(methodInfo)->huatuoData);
+		if (imi)
 		{
-			return (InterpMethodInfo*)methodInfo->huatuoData;
+			return imi;
 		}
 
-		metadata::MethodBody& originMethod = image->GetMethodBody(methodInfo->token);
-		InterpMethodInfo* imi = new (IL2CPP_MALLOC_ZERO(sizeof(InterpMethodInfo))) InterpMethodInfo;
-		transform::HiTransform::Transform(image, methodInfo, originMethod, *imi);
-		il2cpp::os::Atomic::FullMemoryBarrier();
-		const_cast<MethodInfo*>(methodInfo)->huatuoData = imi;
+		imi = new (IL2CPP_MALLOC_ZERO(sizeof(InterpMethodInfo))) InterpMethodInfo;
+		bool fromCache = transform::TransformCache::TryLoad(image, methodInfo, *imi);
+		if (!fromCache)
+		{
+			metadata::MethodBody& originMethod = image->GetMethodBody(methodInfo->token);
+			transform::HiTransform::Transform(image, methodInfo, originMethod, *imi,
+				s_tierUpInvokeThreshold > 0 ? transform::TransformTier::Baseline : transform::TransformTier::Optimized);
+		}
+		InterpMethodInfo* installed = (InterpMethodInfo*)il2cpp::os::Atomic::CompareExchangePointer(&const_cast<MethodInfo*>(methodInfo)->huatuoData, (void*)imi, (void*)nullptr);
+		if (installed)
+		{
+			FreeInterpMethodInfo(imi);
+			return installed;
+		}
+		if (!fromCache)
+		{
+			transform::TransformCache::AddTransformedMethod(image, imi);
+		}
 		return imi;
 	}
 
+	// 在触发升级的线程上同步转换。转换失败时保留基础版本,并标记不再尝试
+	InterpMethodInfo* InterpreterModule::TierUpMethod(const InterpMethodInfo* imi)
+	{
+		const MethodInfo* methodInfo = imi->method;
+		InterpMethodInfo* installed = (InterpMethodInfo*)il2cpp::os::Atomic::ReadPointer(&const_cast<MethodInfo*>(methodInfo)->huatuoData);
+		if (installed != imi)
+		{
+			return installed;
+		}
+
+		metadata::Image* image = metadata::MetadataModule::GetImage(methodInfo->klass);
+		InterpMethodInfo* optimized = new (IL2CPP_MALLOC_ZERO(sizeof(InterpMethodInfo))) InterpMethodInfo;
+		try
+		{
+			metadata::MethodBody& originMethod = image->GetMethodBody(methodInfo->token);
+			transform::HiTransform::Transform(image, methodInfo, originMethod, *optimized, transform::TransformTier::Optimized);
+		}
+		catch (Il2CppExceptionWrapper&)
+		{
+			FreeInterpMethodInfo(optimized);
+			imi->tierUpFailed = true;
+			return installed;
+		}
+		installed = (InterpMethodInfo*)il2cpp::os::Atomic::CompareExchangePointer(&const_cast<MethodInfo*>(methodInfo)->huatuoData, (void*)optimized, (void*)imi);
+		if (installed != imi)
+		{
+			FreeInterpMethodInfo(optimized);
+			return installed;
+		}
+		return optimized;
+	}
+
+	PretransformTask* InterpreterModule::PretransformAssembly(metadata::Image* image, int32_t threadCount, const uint32_t* priorityMethodTokens, int32_t priorityMethodCount)
+	{
+		PretransformTask* task = new PretransformTask(image, priorityMethodTokens, priorityMethodCount);
+		task->Start(threadCount);
+		return task;
+	}
+
 
 }
 }
 
+void huatuo_set_tier_up_thresholds(uint32_t invokeThreshold, uint32_t backEdgeThreshold)
+{
+	huatuo::interpreter::InterpreterModule::SetTierUpThresholds(invokeThreshold, backEdgeThreshold);
+}
@@ -3,6 +3,7 @@
 #include "../CommonDef.h"
 #include "MethodBridge.h"
 #include "Engine.h"
+#include "PretransformTask.h"
 #include "../metadata/Image.h"
 
 namespace huatuo
@@ -28,8 +29,44 @@ namespace interpreter
 			return *state;
 		}
 
+		// 线程退出时释放解释器栈
+		static void FreeCurrentThreadMachineState()
+		{
+			MachineState* state = nullptr;
+			s_machineState.GetValue((void**)&state);
+			if (state)
+			{
+				s_machineState.SetValue(nullptr);
+				delete state;
+			}
+		}
+
 		static InterpMethodInfo* GetInterpMethodInfo(metadata::Image* image, const MethodInfo* methodInfo);
 
+		// 对基础版本做优化转换并替换MethodInfo::huatuoData,返回当前安装的版本。
+		// 旧版本不释放,正在执行它的帧可以继续执行到返回。
+		static InterpMethodInfo* TierUpMethod(const InterpMethodInfo* imi);
+
+		static uint32_t GetTierUpInvokeThreshold()
+		{
+			return s_tierUpInvokeThreshold;
+		}
+
+		static uint32_t GetTierUpBackEdgeThreshold()
+		{
+			return s_tierUpBackEdgeThreshold;
+		}
+
+		// 回跳次数阈值为0时循环不触发升级。调用次数阈值为0时关闭分层,之后首次转换的函数直接优化转换
+		static void SetTierUpThresholds(uint32_t invokeThreshold, uint32_t backEdgeThreshold)
+		{
+			s_tierUpInvokeThreshold = invokeThreshold;
+			s_tierUpBackEdgeThreshold = backEdgeThreshold;
+		}
+
+		// 启动后台线程预先转换程序集的函数,返回的任务由调用者delete
+		static PretransformTask* PretransformAssembly(metadata::Image* image, int32_t threadCount, const uint32_t* priorityMethodTokens, int32_t priorityMethodCount);
+
 		static bool ComputSignature(const Il2CppMethodDefinition* method, bool call, char* signatureBuffer, size_t bufferSize);
 		static bool ComputSignature(const MethodInfo* method, bool call, char* sigBuf, size_t bufferSize);
 		static bool ComputSignature(const Il2CppType* ret, const Il2CppType* params, uint32_t paramCount, bool instanceCall, char* sigBuf, size_t bufferSize);
@@ -40,12 +77,22 @@ namespace interpreter
 		static Il2CppMethodPointer GetAdjustThunkMethodPointer(const MethodInfo* method);
 		static Managed2NativeCallMethod GetManaged2NativeMethodPointer(const MethodInfo* method, bool forceStatic);
 		static Managed2NativeCallMethod GetManaged2NativeMethodPointer(const metadata::ResolveStandAloneMethodSig& methodSig);
+		static Managed2NativeCallMethod GetManaged2NativeMethodPointer(const char* signature);
+		static const char* GetManaged2NativeMethodSignature(Managed2NativeCallMethod method);
 
 		static InvokerMethod GetMethodInvoker(const Il2CppMethodDefinition* method);
 		static InvokerMethod GetMethodInvoker(const MethodInfo* method);
 
 	private:
 		static il2cpp::os::ThreadLocalValue s_machineState;
+		static uint32_t s_tierUpInvokeThreshold;
+		static uint32_t s_tierUpBackEdgeThreshold;
 	};
 }
+}
+
+extern "C"
+{
+	// 需在加载热更新程序集前调用,已经超过新阈值的计数不会再触发升级
+	IL2CPP_EXPORT void huatuo_set_tier_up_thresholds(uint32_t invokeThreshold, uint32_t backEdgeThreshold);
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 ﻿
 #include "Interpreter.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "codegen/il2cpp-codegen-il2cpp.h"
 #include "vm/Object.h"
@@ -19,6 +21,7 @@
 #include "MemoryUtil.h"
 #include "../metadata/MetadataModule.h"
 #include "InterpreterModule.h"
+#include "GenericMethodCache.h"
 
 using namespace huatuo::metadata;
 
@@ -210,6 +213,49 @@ namespace interpreter
 		}
 	}
 
+	template<typename T>
+	inline T HiMathAbs(T x)
+	{
+		if (x == std::numeric_limits<T>::min())
+		{
+			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetOverflowException("Negating the minimum value of a twos complement number is invalid."));
+		}
+		return x < 0 ? -x : x;
+	}
+
+	inline float HiMathAbs(float x)
+	{
+		return std::fabs(x);
+	}
+
+	inline double HiMathAbs(double x)
+	{
+		return std::fabs(x);
+	}
+
+	// 与System.Math一致,浮点数有一个为NaN时返回NaN
+	template<typename T>
+	inline T HiMathMin(T a, T b)
+	{
+		return (a < b || a != a) ? a : b;
+	}
+
+	template<typename T>
+	inline T HiMathMax(T a, T b)
+	{
+		return (a > b || a != a) ? a : b;
+	}
+
+	template<typename T>
+	inline T HiMathClamp(T value, T min, T max)
+	{
+		if (min > max)
+		{
+			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArgumentException("min", "min cannot be greater than max."));
+		}
+		return value < min ? min : (value > max ? max : value);
+	}
+
 
 
 #define DefCompare(cmp, op) template<typename T> bool Compare##cmp(T a, T b) { return a op b; }
@@ -253,9 +299,9 @@ inline bool Compare##cmp(double a, double b) { return a op b; }
 		}
 	}
 
-#define CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(ARR) CHECK_NOT_NULL_THROW(ARR); \
+#define CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(ARR) CHECK_NOT_NULL_EX(ARR); \
 if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
-	il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetIndexOutOfRangeException()); \
+	RAISE_EX(il2cpp::vm::Exception::GetIndexOutOfRangeException()); \
 }
 
 	inline void CHECK_TYPE_MATCH_ELSE_THROW(Il2CppClass* klass1, Il2CppClass* klass2)
@@ -266,16 +312,9 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 		}
 	}
 
-	inline void CheckArrayElementTypeCompatible(Il2CppClass* arrKlass, Il2CppClass* eleKlass)
-	{
-		if (il2cpp::vm::Class::GetElementClass(arrKlass) != eleKlass)
-		{
-			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArrayTypeMismatchException());
-		}
-	}
-
-#define CHECK_ARRAY_INDEX_IN_RANGE_ELSE_THROW(obj, length) if (length >= il2cpp::vm::Array::GetLength(obj)) { il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetIndexOutOfRangeException()); }
-#define CHECK_ARRAY_TYPE_COMPATIBLE(arr, klazz) if (!il2cpp::vm::Class::IsAssignableFrom((arr)->klass->element_class, klazz)) { il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArrayTypeMismatchException()); }
+#define CHECK_ARRAY_INDEX_IN_RANGE_ELSE_THROW(obj, length) if (length >= il2cpp::vm::Array::GetLength(obj)) { RAISE_EX(il2cpp::vm::Exception::GetIndexOutOfRangeException()); }
+#define CHECK_ARRAY_TYPE_COMPATIBLE(arr, klazz) if (!il2cpp::vm::Class::IsAssignableFrom((arr)->klass->element_class, klazz)) { RAISE_EX(il2cpp::vm::Exception::GetArrayTypeMismatchException()); }
+#define CHECK_ARRAY_ELEMENT_TYPE_MATCH(arrKlass, eleKlass) if (il2cpp::vm::Class::GetElementClass(arrKlass) != (eleKlass)) { RAISE_EX(il2cpp::vm::Exception::GetArrayTypeMismatchException()); }
 
 #define GET_RUNTIMEHANDLE_FROM_TOKEN(token) ((void*)nullptr)
 
@@ -311,7 +350,7 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 			if (result->genericMethod && method->genericMethod) // means it's genericInstance method 或generic method
 			{
 				//IL2CPP_ASSERT(method->genericMethod);
-				result = il2cpp::metadata::GenericMetadata::Inflate(GetUnderlyingMethodInfo(result), &method->genericMethod->context);
+				result = GenericMethodCache::Inflate(GetUnderlyingMethodInfo(result), &method->genericMethod->context);
 			}
 		}
 		else
@@ -321,6 +360,44 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 		return const_cast<MethodInfo*>(result);
 	}
 
+	inline MethodInfo* GetObjectVirtualMethodWithInlineCache(Il2CppObject* obj, const MethodInfo* method, VirtualCallInlineCache* cache)
+	{
+		if (!huatuo::metadata::IsVirtualMethod(method->flags))
+		{
+			return const_cast<MethodInfo*>(method);
+		}
+		CHECK_NOT_NULL_THROW(obj);
+		Il2CppClass* klass = obj->klass;
+		for (VirtualCallInlineCache::Entry& entry : cache->entries)
+		{
+			if (entry.klass == klass)
+			{
+				// 表项正在被其他线程填充时method可能尚未写入
+				MethodInfo* cachedMethod = entry.method;
+				if (cachedMethod)
+				{
+					return cachedMethod;
+				}
+				break;
+			}
+		}
+		MethodInfo* result = GET_OBJECT_VIRTUAL_METHOD(obj, method);
+		for (VirtualCallInlineCache::Entry& entry : cache->entries)
+		{
+			Il2CppClass* oldKlass = entry.klass ? entry.klass : il2cpp::os::Atomic::CompareExchangePointer(&entry.klass, klass, (Il2CppClass*)nullptr);
+			if (oldKlass == nullptr)
+			{
+				il2cpp::os::Atomic::ExchangePointer(&entry.method, result);
+				break;
+			}
+			if (oldKlass == klass)
+			{
+				break;
+			}
+		}
+		return result;
+	}
+
 #define GET_OBJECT_INTERFACE_METHOD(obj, intfKlass, slot) (MethodInfo*)nullptr
 
 	inline void* HiUnbox(Il2CppObject* obj, Il2CppClass* klass)
@@ -613,16 +690,28 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 
 #define MEMORY_BARRIER() il2cpp::os::Atomic::FullMemoryBarrier()
 
+#if HUATUO_ENABLE_STATIC_FIELD_OPCODE_PATCHING
+// 类构造函数执行完后将当前指令改写为不检查类构造函数的版本。指令长度都是偶数,opcode按2字节对齐,
+// 写入是原子的;多个线程同时改写时写入的也是同一个值。
+#define PATCH_CCTOR_FREE_OPCODE(klass, op) if ((klass)->cctor_finished) { *(HiOpcodeEnum*)ip = HiOpcodeEnum::op; }
+#else
+#define PATCH_CCTOR_FREE_OPCODE(klass, op)
+#endif
+
 #pragma endregion
 
 #pragma region function
 
+	inline MethodInfo* GetDelegateActualMethod(const MethodInfo* method, Il2CppObject* target)
+	{
+		return huatuo::metadata::IsInstanceMethod(method) ? GET_OBJECT_VIRTUAL_METHOD(target, method) : const_cast<MethodInfo*>(method);
+	}
+
 	inline void CallDelegateMethod(const MethodInfo* method, Il2CppObject* obj, Managed2NativeCallMethod staticM2NMethod, Managed2NativeCallMethod instanceM2NMethod, uint16_t* argIdxs, StackObject* localVarBase, void* ret)
 	{
 		if (huatuo::metadata::IsInstanceMethod(method))
 		{
 			(localVarBase + argIdxs[0])->obj = obj;
-			method = GET_OBJECT_VIRTUAL_METHOD(obj, method);
 			instanceM2NMethod(method, argIdxs, localVarBase, ret);
 		}
 		else
@@ -631,24 +720,39 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 		}
 	}
 
-	inline void HiCallDelegate(Il2CppMulticastDelegate* del, Managed2NativeCallMethod staticM2NMethod, Managed2NativeCallMethod instanceM2NMethod, uint16_t* argIdxs, StackObject* localVarBase, void* ret)
+	// 委托参数在eval stack上紧跟委托对象,实例函数用target覆盖委托对象所在位置作为this
+	inline StackObject* PrepareInterpDelegateArgs(const MethodInfo* method, Il2CppObject* target, uint16_t* argIdxs, StackObject* localVarBase)
 	{
-		if (del->delegates == nullptr)
+		StackObject* argBase = localVarBase + argIdxs[0];
+		if (huatuo::metadata::IsInstanceMethod(method))
 		{
-			CallDelegateMethod(del->delegate.method, del->delegate.target, staticM2NMethod, instanceM2NMethod, argIdxs, localVarBase, ret);
+			argBase->obj = method->klass->valuetype ? target + 1 : target;
+			return argBase;
 		}
-		else
+		return argBase + 1;
+	}
+
+	// 循环头处的栈上替换。循环头的eval stack为空,两个版本的参数和局部变量布局相同,
+	// 帧内容不用转换,只需换成优化版本并从其中同一循环头继续执行。不能替换时返回nullptr
+	static byte* TryEnterOptimizedLoop(InterpFrameGroup& interpFrameGroup, InterpFrame* frame, int32_t ilOffset)
+	{
+		const InterpMethodInfo* imi = frame->method;
+		if (imi->tierUpFailed || InterpreterModule::GetTierUpBackEdgeThreshold() == 0)
 		{
-			Il2CppArray* dels = del->delegates;
-			for (il2cpp_array_size_t i = 0; i < dels->max_length; i++)
-			{
-				Il2CppMulticastDelegate* subDel = il2cpp_array_get(dels, Il2CppMulticastDelegate*, i);
-				IL2CPP_ASSERT(subDel);
-				//IL2CPP_ASSERT(subDel->delegate.method->klass->parent == il2cpp_defaults.multicastdelegate_class);
-				IL2CPP_ASSERT(subDel->delegates == nullptr);
-				CallDelegateMethod(subDel->delegate.method, subDel->delegate.target, staticM2NMethod, instanceM2NMethod, argIdxs, localVarBase, ret);
-			}
+			return nullptr;
 		}
+		const InterpMethodInfo* optimized = InterpreterModule::TierUpMethod(imi);
+		if (!optimized->isOptimized)
+		{
+			return nullptr;
+		}
+		const InterpOsrEntry* entry = std::lower_bound(optimized->osrEntries, optimized->osrEntries + optimized->osrEntryCount, ilOffset,
+			[](const InterpOsrEntry& e, int32_t offset) { return e.ilOffset < offset; });
+		if (entry == optimized->osrEntries + optimized->osrEntryCount || entry->ilOffset != ilOffset || !interpFrameGroup.ReplaceFrameMethod(frame, optimized))
+		{
+			return nullptr;
+		}
+		return optimized->codes + entry->irOffset;
 	}
 
 
@@ -667,9 +771,13 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 
 
 	// maxStackSize包含 arg + local + eval,对于解释器栈来说，可能多余
-#define PREPARE_NEW_FRAME(newMethodInfo, argBasePtr, retPtr, withArgStack) { \
+#define PREPARE_NEW_FRAME(newMethodInfo, argBasePtr, retPtr, argMode) { \
 	imi = newMethodInfo->huatuoData ? (InterpMethodInfo*)newMethodInfo->huatuoData : InterpreterModule::GetInterpMethodInfo(huatuo::metadata::MetadataModule::GetImage(newMethodInfo->klass), newMethodInfo); \
-	frame = interpFrameGroup.EnterFrame(imi, argBasePtr, withArgStack); \
+	if (!imi->isOptimized && ++imi->invokeCount == InterpreterModule::GetTierUpInvokeThreshold()) \
+	{ \
+		imi = InterpreterModule::TierUpMethod(imi); \
+	} \
+	frame = interpFrameGroup.EnterFrame(imi, argBasePtr, argMode); \
 	RuntimeClassCCtorInit(newMethodInfo); \
 	frame->ret = retPtr; \
 	ip = ipBase = imi->codes; \
@@ -690,43 +798,64 @@ if (ARR->max_length <= (*(uint32_t*)(localVarBase + __index))) { \
 
 #define CALL_INTERP(nextIp, methodInfo, argBasePtr, retPtr) { \
 	SAVE_CUR_FRAME(nextIp) \
-	PREPARE_NEW_FRAME(methodInfo, argBasePtr, retPtr, true); \
+	PREPARE_NEW_FRAME(methodInfo, argBasePtr, retPtr, FrameArgMode::InPlace); \
 }
 
 
-#define CALL_DELEGATE(_resolvedArgIdxs, _del, _managed2NativeStaticCall, _managed2NativeInstanceCall, _ret) \
-if (_del->delegates == nullptr) \
-{\
-    const MethodInfo* method = _del->delegate.method; \
-    if (huatuo::metadata::IsInterpreterMethod(method))\
-    {\
-        if (huatuo::metadata::IsInstanceMethod(method))\
-        {\
-            Il2CppObject* obj = _del->delegate.target; \
-            (localVarBase + _resolvedArgIdxs[0])->obj = obj; \
-            method = GET_OBJECT_VIRTUAL_METHOD(obj, method); \
-            _managed2NativeInstanceCall(method, _resolvedArgIdxs, localVarBase, _ret); \
-        }\
-        else\
-        {\
-            _managed2NativeStaticCall(method, _resolvedArgIdxs + 1, localVarBase, _ret); \
-        }\
-    }\
-    else\
-    {\
-        CallDelegateMethod(_del->delegate.method, _del->delegate.target, _managed2NativeStaticCall, _managed2NativeInstanceCall, _resolvedArgIdxs, localVarBase, _ret); \
-    }\
-}\
-else\
-{\
-    Il2CppArray* _dels = _del->delegates; \
-    for (il2cpp_array_size_t i = 0; i < _dels->max_length; i++)\
-    {\
-        Il2CppMulticastDelegate* subDel = il2cpp_array_get(_dels, Il2CppMulticastDelegate*, i); \
-        IL2CPP_ASSERT(subDel); \
-        IL2CPP_ASSERT(subDel->delegates == nullptr); \
-        CallDelegateMethod(subDel->delegate.method, subDel->delegate.target, _managed2NativeStaticCall, _managed2NativeInstanceCall, _resolvedArgIdxs, localVarBase, _ret); \
-    }\
+// 委托目标为解释器函数时直接在解释器循环中压栈调用,不经过managed2native桥接。
+// 多播委托的调用进度保存在invokeState开始的栈变量中(委托列表, 下一个索引, 返回值暂存),
+// 解释器函数返回后重新执行本指令,继续调用下一个委托。只有最后一个委托的返回值写入ret。
+// 多播时每次调用都要复制参数,因为被调函数可能修改参数。
+#define CALL_DELEGATE(_instSize, _argIdxs, _invokeState, _managed2NativeStaticCall, _managed2NativeInstanceCall, _ret) \
+{ \
+	StackObject* _state = localVarBase + (_invokeState); \
+	Il2CppArray* _dels = (Il2CppArray*)_state[0].ptr; \
+	if (!_dels) \
+	{ \
+		Il2CppMulticastDelegate* _del = (Il2CppMulticastDelegate*)localVarBase[_argIdxs[0]].obj; \
+		CHECK_NOT_NULL_EX(_del); \
+		if (_del->delegates == nullptr) \
+		{ \
+			Il2CppObject* _target = _del->delegate.target; \
+			MethodInfo* _method = GetDelegateActualMethod(_del->delegate.method, _target); \
+			if (huatuo::metadata::IsInterpreterMethod(_method)) \
+			{ \
+				CALL_INTERP(ip + (_instSize), _method, PrepareInterpDelegateArgs(_method, _target, _argIdxs, localVarBase), _ret); \
+			} \
+			else \
+			{ \
+				CallDelegateMethod(_method, _target, _managed2NativeStaticCall, _managed2NativeInstanceCall, _argIdxs, localVarBase, _ret); \
+				ip += (_instSize); \
+			} \
+			HI_DISPATCH_NEXT(); \
+		} \
+		_dels = _del->delegates; \
+		_state[0].ptr = _dels; \
+		_state[1].i32 = 0; \
+	} \
+	for (;;) \
+	{ \
+		int32_t _idx = _state[1].i32; \
+		if (_idx >= (int32_t)_dels->max_length) \
+		{ \
+			ip += (_instSize); \
+			break; \
+		} \
+		_state[1].i32 = _idx + 1; \
+		Il2CppMulticastDelegate* _subDel = il2cpp_array_get(_dels, Il2CppMulticastDelegate*, _idx); \
+		IL2CPP_ASSERT(_subDel && _subDel->delegates == nullptr); \
+		void* _subRet = (_ret) && _idx + 1 < (int32_t)_dels->max_length ? (void*)(_state + 2) : (void*)(_ret); \
+		Il2CppObject* _target = _subDel->delegate.target; \
+		MethodInfo* _method = GetDelegateActualMethod(_subDel->delegate.method, _target); \
+		if (huatuo::metadata::IsInterpreterMethod(_method)) \
+		{ \
+			SAVE_CUR_FRAME(ip); \
+			PREPARE_NEW_FRAME(_method, PrepareInterpDelegateArgs(_method, _target, _argIdxs, localVarBase), _subRet, FrameArgMode::CopyStack); \
+			break; \
+		} \
+		CallDelegateMethod(_method, _target, _managed2NativeStaticCall, _managed2NativeInstanceCall, _argIdxs, localVarBase, _subRet); \
+	} \
+	HI_DISPATCH_NEXT(); \
 }
 
 #pragma endregion
@@ -744,15 +873,11 @@ while (true) \
 { \
 	IL2CPP_ASSERT(IN_EXCEPTION_HANDE()); \
 	IL2CPP_ASSERT(curException); \
-	int32_t exClauseNum = (int32_t)imi->exClauses.size(); \
+	int32_t exClauseNum = (int32_t)imi->exClauseCount; \
 	for (; frame->nextExClauseIndex < exClauseNum; ) \
 	{ \
-		InterpExceptionClause* iec = imi->exClauses[frame->nextExClauseIndex++]; \
-		if (frame->throwOffset < iec->tryBeginOffset) \
-		{ \
-			break; \
-		} \
-		if (frame->throwOffset < iec->tryEndOffset) \
+		const InterpExceptionClause* iec = imi->exClauses + frame->nextExClauseIndex++; \
+		if (frame->throwOffset >= iec->tryBeginOffset && frame->throwOffset < iec->tryEndOffset) \
 		{ \
 			switch (iec->flags) \
 			{ \
@@ -804,50 +929,35 @@ while (true) \
 	} \
 }
 
-
+// leave需要执行的finally在转换时已按由内到外的顺序存入leaveFinallyClauseIndexes,以-1结尾。
+// nextExClauseIndex指向其中下一个要执行的finally
 #define CONTINUE_NEXT_FINALLY() \
 IL2CPP_ASSERT(frame->exFlowType == ExceptionFlowType::Leave); \
-int32_t exClauseNum = (int32_t)imi->exClauses.size(); \
-for (; frame->nextExClauseIndex < exClauseNum; ) \
+int32_t finallyClauseIndex = imi->leaveFinallyClauseIndexes[frame->nextExClauseIndex++]; \
+if (finallyClauseIndex >= 0) \
 { \
-	InterpExceptionClause* iec = imi->exClauses[frame->nextExClauseIndex++]; \
-	if (frame->leaveTarget < iec->tryBeginOffset) \
-	{ \
-		break; \
-	} \
-	if (frame->leaveTarget < iec->tryEndOffset) \
-	{ \
-		switch (iec->flags) \
-		{ \
-		case CorILExceptionClauseType::Finally: \
-		{ \
-			ip = ipBase + iec->handlerBeginOffset; \
-			goto LoopStart; \
-		} \
-		case CorILExceptionClauseType::Exception: \
-		case CorILExceptionClauseType::Filter: \
-		case CorILExceptionClauseType::Fault: \
-		{ \
-			break; \
-		} \
-		default: \
-		{ \
-			IL2CPP_ASSERT(false); \
-		} \
-		} \
-	} \
+	ip = ipBase + imi->exClauses[finallyClauseIndex].handlerBeginOffset; \
 } \
-ip = ipBase + frame->leaveTarget; \
-frame->leaveTarget = 0;
+else \
+{ \
+	ip = ipBase + frame->leaveTarget; \
+	frame->leaveTarget = 0; \
+}
+
+// 解释器内抛出的异常直接跳转到RaiseInterpException查找handler,不经过C++的throw和栈展开。
+// 只有异常离开最外层解释器帧(UnWindFail)时才用C++异常抛给调用者。
+// native函数及各辅助函数中抛出的C++异常仍由catch接住后走同样的流程。
+#define RAISE_EX(ex) { curException = (ex); goto RaiseInterpException; }
+#define CHECK_NOT_NULL_EX(ptr) if (!(ptr)) { RAISE_EX(il2cpp::vm::Exception::GetNullReferenceException(il2cpp::utils::StringView<Il2CppChar>::Empty())); }
 
-#define THROW_EX(ex) { CHECK_NOT_NULL_THROW(ex);   il2cpp::vm::Exception::Raise(ex, const_cast<MethodInfo*>(imi->method));}
-#define RETHROW_EX() { il2cpp::vm::Exception::Raise(curException, const_cast<MethodInfo*>(imi->method)); }
+#define THROW_EX(ex) { Il2CppException* __thrownEx = (ex); CHECK_NOT_NULL_EX(__thrownEx); RAISE_EX(__thrownEx); }
+#define RETHROW_EX() { RAISE_EX(curException); }
 
-#define LEAVE_EX(target)  { \
+#define LEAVE_EX(target, finallyIndex)  { \
 	frame->leaveTarget = target; \
 	curException = nullptr; \
 	frame->exFlowType = ExceptionFlowType::Leave;\
-	frame->nextExClauseIndex = 0; \
+	frame->nextExClauseIndex = finallyIndex; \
 	CONTINUE_NEXT_FINALLY(); \
 }
 
@@ -872,6 +982,26 @@ else \
 
 #pragma endregion 
 
+#pragma region dispatch
+
+#if HUATUO_ENABLE_THREADED_DISPATCH
+
+#define HI_OPCODE_CASE(op) Label_##op
+#define HI_OPCODE_DEFAULT Label_Default
+#define HI_DISPATCH_NEXT() goto *s_dispatchTable[*(uint16_t*)ip]
+#define HI_DISPATCH_BEGIN() HI_DISPATCH_NEXT();
+
+#else
+
+#define HI_OPCODE_CASE(op) case HiOpcodeEnum::op
+#define HI_OPCODE_DEFAULT default
+#define HI_DISPATCH_NEXT() continue
+#define HI_DISPATCH_BEGIN() switch (*(HiOpcodeEnum*)ip)
+
+#endif
+
+#pragma endregion
+
 
 	void Interpreter::Execute(const MethodInfo* methodInfo, StackObject* args, StackObject* ret)
 	{
@@ -879,13 +1009,822 @@ else \
 		MachineState& machine = InterpreterModule::GetCurrentThreadMachineState();
 		InterpFrameGroup interpFrameGroup(machine);
 
+#if HUATUO_ENABLE_THREADED_DISPATCH
+		// 按HiOpcodeEnum顺序排列,新增指令时必须同步追加
+		static const void* const s_dispatchTable[] =
+		{
+			//!!!{{DISPATCH
+			&&Label_InitLocals_n_2,
+			&&Label_InitLocals_n_4,
+			&&Label_LdlocVarVar,
+			&&Label_LdlocVarVarSize,
+			&&Label_LdlocVarAddress,
+			&&Label_LdcVarConst_1,
+			&&Label_LdcVarConst_2,
+			&&Label_LdcVarConst_4,
+			&&Label_LdcVarConst_8,
+			&&Label_LdnullVar,
+			&&Label_LdindVarVar_i1,
+			&&Label_LdindVarVar_u1,
+			&&Label_LdindVarVar_i2,
+			&&Label_LdindVarVar_u2,
+			&&Label_LdindVarVar_i4,
+			&&Label_LdindVarVar_u4,
+			&&Label_LdindVarVar_i8,
+			&&Label_LdindVarVar_f4,
+			&&Label_LdindVarVar_f8,
+			&&Label_StindVarVar_i1,
+			&&Label_StindVarVar_i2,
+			&&Label_StindVarVar_i4,
+			&&Label_StindVarVar_i8,
+			&&Label_StindVarVar_f4,
+			&&Label_StindVarVar_f8,
+			&&Label_LocalAllocVarVar_n_2,
+			&&Label_LocalAllocVarVar_n_4,
+			&&Label_InitblkVarVarVar,
+			&&Label_CpblkVarVar,
+			&&Label_MemoryBarrier,
+			&&Label_ConvertVarVar_i1_i1,
+			&&Label_ConvertVarVar_i1_u1,
+			&&Label_ConvertVarVar_i1_i2,
+			&&Label_ConvertVarVar_i1_u2,
+			&&Label_ConvertVarVar_i1_i4,
+			&&Label_ConvertVarVar_i1_u4,
+			&&Label_ConvertVarVar_i1_i8,
+			&&Label_ConvertVarVar_i1_u8,
+			&&Label_ConvertVarVar_i1_f4,
+			&&Label_ConvertVarVar_i1_f8,
+			&&Label_ConvertVarVar_u1_i1,
+			&&Label_ConvertVarVar_u1_u1,
+			&&Label_ConvertVarVar_u1_i2,
+			&&Label_ConvertVarVar_u1_u2,
+			&&Label_ConvertVarVar_u1_i4,
+			&&Label_ConvertVarVar_u1_u4,
+			&&Label_ConvertVarVar_u1_i8,
+			&&Label_ConvertVarVar_u1_u8,
+			&&Label_ConvertVarVar_u1_f4,
+			&&Label_ConvertVarVar_u1_f8,
+			&&Label_ConvertVarVar_i2_i1,
+			&&Label_ConvertVarVar_i2_u1,
+			&&Label_ConvertVarVar_i2_i2,
+			&&Label_ConvertVarVar_i2_u2,
+			&&Label_ConvertVarVar_i2_i4,
+			&&Label_ConvertVarVar_i2_u4,
+			&&Label_ConvertVarVar_i2_i8,
+			&&Label_ConvertVarVar_i2_u8,
+			&&Label_ConvertVarVar_i2_f4,
+			&&Label_ConvertVarVar_i2_f8,
+			&&Label_ConvertVarVar_u2_i1,
+			&&Label_ConvertVarVar_u2_u1,
+			&&Label_ConvertVarVar_u2_i2,
+			&&Label_ConvertVarVar_u2_u2,
+			&&Label_ConvertVarVar_u2_i4,
+			&&Label_ConvertVarVar_u2_u4,
+			&&Label_ConvertVarVar_u2_i8,
+			&&Label_ConvertVarVar_u2_u8,
+			&&Label_ConvertVarVar_u2_f4,
+			&&Label_ConvertVarVar_u2_f8,
+			&&Label_ConvertVarVar_i4_i1,
+			&&Label_ConvertVarVar_i4_u1,
+			&&Label_ConvertVarVar_i4_i2,
+			&&Label_ConvertVarVar_i4_u2,
+			&&Label_ConvertVarVar_i4_i4,
+			&&Label_ConvertVarVar_i4_u4,
+			&&Label_ConvertVarVar_i4_i8,
+			&&Label_ConvertVarVar_i4_u8,
+			&&Label_ConvertVarVar_i4_f4,
+			&&Label_ConvertVarVar_i4_f8,
+			&&Label_ConvertVarVar_u4_i1,
+			&&Label_ConvertVarVar_u4_u1,
+			&&Label_ConvertVarVar_u4_i2,
+			&&Label_ConvertVarVar_u4_u2,
+			&&Label_ConvertVarVar_u4_i4,
+			&&Label_ConvertVarVar_u4_u4,
+			&&Label_ConvertVarVar_u4_i8,
+			&&Label_ConvertVarVar_u4_u8,
+			&&Label_ConvertVarVar_u4_f4,
+			&&Label_ConvertVarVar_u4_f8,
+			&&Label_ConvertVarVar_i8_i1,
+			&&Label_ConvertVarVar_i8_u1,
+			&&Label_ConvertVarVar_i8_i2,
+			&&Label_ConvertVarVar_i8_u2,
+			&&Label_ConvertVarVar_i8_i4,
+			&&Label_ConvertVarVar_i8_u4,
+			&&Label_ConvertVarVar_i8_i8,
+			&&Label_ConvertVarVar_i8_u8,
+			&&Label_ConvertVarVar_i8_f4,
+			&&Label_ConvertVarVar_i8_f8,
+			&&Label_ConvertVarVar_u8_i1,
+			&&Label_ConvertVarVar_u8_u1,
+			&&Label_ConvertVarVar_u8_i2,
+			&&Label_ConvertVarVar_u8_u2,
+			&&Label_ConvertVarVar_u8_i4,
+			&&Label_ConvertVarVar_u8_u4,
+			&&Label_ConvertVarVar_u8_i8,
+			&&Label_ConvertVarVar_u8_u8,
+			&&Label_ConvertVarVar_u8_f4,
+			&&Label_ConvertVarVar_u8_f8,
+			&&Label_ConvertVarVar_f4_i1,
+			&&Label_ConvertVarVar_f4_u1,
+			&&Label_ConvertVarVar_f4_i2,
+			&&Label_ConvertVarVar_f4_u2,
+			&&Label_ConvertVarVar_f4_i4,
+			&&Label_ConvertVarVar_f4_u4,
+			&&Label_ConvertVarVar_f4_i8,
+			&&Label_ConvertVarVar_f4_u8,
+			&&Label_ConvertVarVar_f4_f4,
+			&&Label_ConvertVarVar_f4_f8,
+			&&Label_ConvertVarVar_f8_i1,
+			&&Label_ConvertVarVar_f8_u1,
+			&&Label_ConvertVarVar_f8_i2,
+			&&Label_ConvertVarVar_f8_u2,
+			&&Label_ConvertVarVar_f8_i4,
+			&&Label_ConvertVarVar_f8_u4,
+			&&Label_ConvertVarVar_f8_i8,
+			&&Label_ConvertVarVar_f8_u8,
+			&&Label_ConvertVarVar_f8_f4,
+			&&Label_ConvertVarVar_f8_f8,
+			&&Label_ConvertOverflowVarVar_i1_i1,
+			&&Label_ConvertOverflowVarVar_i1_u1,
+			&&Label_ConvertOverflowVarVar_i1_i2,
+			&&Label_ConvertOverflowVarVar_i1_u2,
+			&&Label_ConvertOverflowVarVar_i1_i4,
+			&&Label_ConvertOverflowVarVar_i1_u4,
+			&&Label_ConvertOverflowVarVar_i1_i8,
+			&&Label_ConvertOverflowVarVar_i1_u8,
+			&&Label_ConvertOverflowVarVar_i1_f4,
+			&&Label_ConvertOverflowVarVar_i1_f8,
+			&&Label_ConvertOverflowVarVar_u1_i1,
+			&&Label_ConvertOverflowVarVar_u1_u1,
+			&&Label_ConvertOverflowVarVar_u1_i2,
+			&&Label_ConvertOverflowVarVar_u1_u2,
+			&&Label_ConvertOverflowVarVar_u1_i4,
+			&&Label_ConvertOverflowVarVar_u1_u4,
+			&&Label_ConvertOverflowVarVar_u1_i8,
+			&&Label_ConvertOverflowVarVar_u1_u8,
+			&&Label_ConvertOverflowVarVar_u1_f4,
+			&&Label_ConvertOverflowVarVar_u1_f8,
+			&&Label_ConvertOverflowVarVar_i2_i1,
+			&&Label_ConvertOverflowVarVar_i2_u1,
+			&&Label_ConvertOverflowVarVar_i2_i2,
+			&&Label_ConvertOverflowVarVar_i2_u2,
+			&&Label_ConvertOverflowVarVar_i2_i4,
+			&&Label_ConvertOverflowVarVar_i2_u4,
+			&&Label_ConvertOverflowVarVar_i2_i8,
+			&&Label_ConvertOverflowVarVar_i2_u8,
+			&&Label_ConvertOverflowVarVar_i2_f4,
+			&&Label_ConvertOverflowVarVar_i2_f8,
+			&&Label_ConvertOverflowVarVar_u2_i1,
+			&&Label_ConvertOverflowVarVar_u2_u1,
+			&&Label_ConvertOverflowVarVar_u2_i2,
+			&&Label_ConvertOverflowVarVar_u2_u2,
+			&&Label_ConvertOverflowVarVar_u2_i4,
+			&&Label_ConvertOverflowVarVar_u2_u4,
+			&&Label_ConvertOverflowVarVar_u2_i8,
+			&&Label_ConvertOverflowVarVar_u2_u8,
+			&&Label_ConvertOverflowVarVar_u2_f4,
+			&&Label_ConvertOverflowVarVar_u2_f8,
+			&&Label_ConvertOverflowVarVar_i4_i1,
+			&&Label_ConvertOverflowVarVar_i4_u1,
+			&&Label_ConvertOverflowVarVar_i4_i2,
+			&&Label_ConvertOverflowVarVar_i4_u2,
+			&&Label_ConvertOverflowVarVar_i4_i4,
+			&&Label_ConvertOverflowVarVar_i4_u4,
+			&&Label_ConvertOverflowVarVar_i4_i8,
+			&&Label_ConvertOverflowVarVar_i4_u8,
+			&&Label_ConvertOverflowVarVar_i4_f4,
+			&&Label_ConvertOverflowVarVar_i4_f8,
+			&&Label_ConvertOverflowVarVar_u4_i1,
+			&&Label_ConvertOverflowVarVar_u4_u1,
+			&&Label_ConvertOverflowVarVar_u4_i2,
+			&&Label_ConvertOverflowVarVar_u4_u2,
+			&&Label_ConvertOverflowVarVar_u4_i4,
+			&&Label_ConvertOverflowVarVar_u4_u4,
+			&&Label_ConvertOverflowVarVar_u4_i8,
+			&&Label_ConvertOverflowVarVar_u4_u8,
+			&&Label_ConvertOverflowVarVar_u4_f4,
+			&&Label_ConvertOverflowVarVar_u4_f8,
+			&&Label_ConvertOverflowVarVar_i8_i1,
+			&&Label_ConvertOverflowVarVar_i8_u1,
+			&&Label_ConvertOverflowVarVar_i8_i2,
+			&&Label_ConvertOverflowVarVar_i8_u2,
+			&&Label_ConvertOverflowVarVar_i8_i4,
+			&&Label_ConvertOverflowVarVar_i8_u4,
+			&&Label_ConvertOverflowVarVar_i8_i8,
+			&&Label_ConvertOverflowVarVar_i8_u8,
+			&&Label_ConvertOverflowVarVar_i8_f4,
+			&&Label_ConvertOverflowVarVar_i8_f8,
+			&&Label_ConvertOverflowVarVar_u8_i1,
+			&&Label_ConvertOverflowVarVar_u8_u1,
+			&&Label_ConvertOverflowVarVar_u8_i2,
+			&&Label_ConvertOverflowVarVar_u8_u2,
+			&&Label_ConvertOverflowVarVar_u8_i4,
+			&&Label_ConvertOverflowVarVar_u8_u4,
+			&&Label_ConvertOverflowVarVar_u8_i8,
+			&&Label_ConvertOverflowVarVar_u8_u8,
+			&&Label_ConvertOverflowVarVar_u8_f4,
+			&&Label_ConvertOverflowVarVar_u8_f8,
+			&&Label_ConvertOverflowVarVar_f4_i1,
+			&&Label_ConvertOverflowVarVar_f4_u1,
+			&&Label_ConvertOverflowVarVar_f4_i2,
+			&&Label_ConvertOverflowVarVar_f4_u2,
+			&&Label_ConvertOverflowVarVar_f4_i4,
+			&&Label_ConvertOverflowVarVar_f4_u4,
+			&&Label_ConvertOverflowVarVar_f4_i8,
+			&&Label_ConvertOverflowVarVar_f4_u8,
+			&&Label_ConvertOverflowVarVar_f4_f4,
+			&&Label_ConvertOverflowVarVar_f4_f8,
+			&&Label_ConvertOverflowVarVar_f8_i1,
+			&&Label_ConvertOverflowVarVar_f8_u1,
+			&&Label_ConvertOverflowVarVar_f8_i2,
+			&&Label_ConvertOverflowVarVar_f8_u2,
+			&&Label_ConvertOverflowVarVar_f8_i4,
+			&&Label_ConvertOverflowVarVar_f8_u4,
+			&&Label_ConvertOverflowVarVar_f8_i8,
+			&&Label_ConvertOverflowVarVar_f8_u8,
+			&&Label_ConvertOverflowVarVar_f8_f4,
+			&&Label_ConvertOverflowVarVar_f8_f8,
+			&&Label_BinOpVarVarVar_Add_i4,
+			&&Label_BinOpVarVarVar_Sub_i4,
+			&&Label_BinOpVarVarVar_Mul_i4,
+			&&Label_BinOpVarVarVar_MulUn_i4,
+			&&Label_BinOpVarVarVar_Div_i4,
+			&&Label_BinOpVarVarVar_DivUn_i4,
+			&&Label_BinOpVarVarVar_Rem_i4,
+			&&Label_BinOpVarVarVar_RemUn_i4,
+			&&Label_BinOpVarVarVar_And_i4,
+			&&Label_BinOpVarVarVar_Or_i4,
+			&&Label_BinOpVarVarVar_Xor_i4,
+			&&Label_BinOpVarVarVar_Add_i8,
+			&&Label_BinOpVarVarVar_Sub_i8,
+			&&Label_BinOpVarVarVar_Mul_i8,
+			&&Label_BinOpVarVarVar_MulUn_i8,
+			&&Label_BinOpVarVarVar_Div_i8,
+			&&Label_BinOpVarVarVar_DivUn_i8,
+			&&Label_BinOpVarVarVar_Rem_i8,
+			&&Label_BinOpVarVarVar_RemUn_i8,
+			&&Label_BinOpVarVarVar_And_i8,
+			&&Label_BinOpVarVarVar_Or_i8,
+			&&Label_BinOpVarVarVar_Xor_i8,
+			&&Label_BinOpVarVarVar_Add_f4,
+			&&Label_BinOpVarVarVar_Sub_f4,
+			&&Label_BinOpVarVarVar_Mul_f4,
+			&&Label_BinOpVarVarVar_Div_f4,
+			&&Label_BinOpVarVarVar_Rem_f4,
+			&&Label_BinOpVarVarVar_Add_f8,
+			&&Label_BinOpVarVarVar_Sub_f8,
+			&&Label_BinOpVarVarVar_Mul_f8,
+			&&Label_BinOpVarVarVar_Div_f8,
+			&&Label_BinOpVarVarVar_Rem_f8,
+			&&Label_BinOpOverflowVarVarVar_Add_i4,
+			&&Label_BinOpOverflowVarVarVar_Sub_i4,
+			&&Label_BinOpOverflowVarVarVar_Mul_i4,
+			&&Label_BinOpOverflowVarVarVar_Add_i8,
+			&&Label_BinOpOverflowVarVarVar_Sub_i8,
+			&&Label_BinOpOverflowVarVarVar_Mul_i8,
+			&&Label_BinOpOverflowVarVarVar_Add_u4,
+			&&Label_BinOpOverflowVarVarVar_Sub_u4,
+			&&Label_BinOpOverflowVarVarVar_Mul_u4,
+			&&Label_BinOpOverflowVarVarVar_Add_u8,
+			&&Label_BinOpOverflowVarVarVar_Sub_u8,
+			&&Label_BinOpOverflowVarVarVar_Mul_u8,
+			&&Label_BitShiftBinOpVarVarVar_Shl_i4_i4,
+			&&Label_BitShiftBinOpVarVarVar_Shr_i4_i4,
+			&&Label_BitShiftBinOpVarVarVar_ShrUn_i4_i4,
+			&&Label_BitShiftBinOpVarVarVar_Shl_i4_i8,
+			&&Label_BitShiftBinOpVarVarVar_Shr_i4_i8,
+			&&Label_BitShiftBinOpVarVarVar_ShrUn_i4_i8,
+			&&Label_BitShiftBinOpVarVarVar_Shl_i8_i4,
+			&&Label_BitShiftBinOpVarVarVar_Shr_i8_i4,
+			&&Label_BitShiftBinOpVarVarVar_ShrUn_i8_i4,
+			&&Label_BitShiftBinOpVarVarVar_Shl_i8_i8,
+			&&Label_BitShiftBinOpVarVarVar_Shr_i8_i8,
+			&&Label_BitShiftBinOpVarVarVar_ShrUn_i8_i8,
+			&&Label_UnaryOpVarVar_Neg_i4,
+			&&Label_UnaryOpVarVar_Not_i4,
+			&&Label_UnaryOpVarVar_Neg_i8,
+			&&Label_UnaryOpVarVar_Not_i8,
+			&&Label_UnaryOpVarVar_Neg_f4,
+			&&Label_UnaryOpVarVar_Neg_f8,
+			&&Label_CheckFiniteVar_f4,
+			&&Label_CheckFiniteVar_f8,
+			&&Label_CompOpVarVarVar_Ceq_i4,
+			&&Label_CompOpVarVarVar_Ceq_i8,
+			&&Label_CompOpVarVarVar_Ceq_f4,
+			&&Label_CompOpVarVarVar_Ceq_f8,
+			&&Label_CompOpVarVarVar_Cgt_i4,
+			&&Label_CompOpVarVarVar_Cgt_i8,
+			&&Label_CompOpVarVarVar_Cgt_f4,
+			&&Label_CompOpVarVarVar_Cgt_f8,
+			&&Label_CompOpVarVarVar_CgtUn_i4,
+			&&Label_CompOpVarVarVar_CgtUn_i8,
+			&&Label_CompOpVarVarVar_CgtUn_f4,
+			&&Label_CompOpVarVarVar_CgtUn_f8,
+			&&Label_CompOpVarVarVar_Clt_i4,
+			&&Label_CompOpVarVarVar_Clt_i8,
+			&&Label_CompOpVarVarVar_Clt_f4,
+			&&Label_CompOpVarVarVar_Clt_f8,
+			&&Label_CompOpVarVarVar_CltUn_i4,
+			&&Label_CompOpVarVarVar_CltUn_i8,
+			&&Label_CompOpVarVarVar_CltUn_f4,
+			&&Label_CompOpVarVarVar_CltUn_f8,
+			&&Label_BranchUncondition_4,
+			&&Label_BranchTrueVar_i4,
+			&&Label_BranchTrueVar_i8,
+			&&Label_BranchFalseVar_i4,
+			&&Label_BranchFalseVar_i8,
+			&&Label_BranchVarVar_Ceq_i4,
+			&&Label_BranchVarVar_Ceq_i8,
+			&&Label_BranchVarVar_Ceq_f4,
+			&&Label_BranchVarVar_Ceq_f8,
+			&&Label_BranchVarVar_CneUn_i4,
+			&&Label_BranchVarVar_CneUn_i8,
+			&&Label_BranchVarVar_CneUn_f4,
+			&&Label_BranchVarVar_CneUn_f8,
+			&&Label_BranchVarVar_Cgt_i4,
+			&&Label_BranchVarVar_Cgt_i8,
+			&&Label_BranchVarVar_Cgt_f4,
+			&&Label_BranchVarVar_Cgt_f8,
+			&&Label_BranchVarVar_CgtUn_i4,
+			&&Label_BranchVarVar_CgtUn_i8,
+			&&Label_BranchVarVar_CgtUn_f4,
+			&&Label_BranchVarVar_CgtUn_f8,
+			&&Label_BranchVarVar_Cge_i4,
+			&&Label_BranchVarVar_Cge_i8,
+			&&Label_BranchVarVar_Cge_f4,
+			&&Label_BranchVarVar_Cge_f8,
+			&&Label_BranchVarVar_CgeUn_i4,
+			&&Label_BranchVarVar_CgeUn_i8,
+			&&Label_BranchVarVar_CgeUn_f4,
+			&&Label_BranchVarVar_CgeUn_f8,
+			&&Label_BranchVarVar_Clt_i4,
+			&&Label_BranchVarVar_Clt_i8,
+			&&Label_BranchVarVar_Clt_f4,
+			&&Label_BranchVarVar_Clt_f8,
+			&&Label_BranchVarVar_CltUn_i4,
+			&&Label_BranchVarVar_CltUn_i8,
+			&&Label_BranchVarVar_CltUn_f4,
+			&&Label_BranchVarVar_CltUn_f8,
+			&&Label_BranchVarVar_Cle_i4,
+			&&Label_BranchVarVar_Cle_i8,
+			&&Label_BranchVarVar_Cle_f4,
+			&&Label_BranchVarVar_Cle_f8,
+			&&Label_BranchVarVar_CleUn_i4,
+			&&Label_BranchVarVar_CleUn_i8,
+			&&Label_BranchVarVar_CleUn_f4,
+			&&Label_BranchVarVar_CleUn_f8,
+			&&Label_BranchJump,
+			&&Label_BranchSwitch,
+			&&Label_NewClassVar,
+			&&Label_NewClassVar_Ctor_0,
+			&&Label_NewClassVar_NotCtor,
+			&&Label_NewValueTypeVar,
+			&&Label_NewClassInterpVar,
+			&&Label_NewClassInterpVar_Ctor_0,
+			&&Label_NewValueTypeInterpVar,
+			&&Label_AdjustValueTypeRefVar,
+			&&Label_BoxRefVarVar,
+			&&Label_LdvirftnVarVar,
+			&&Label_RetVar_ret_8,
+			&&Label_RetVar_ret_12,
+			&&Label_RetVar_ret_16,
+			&&Label_RetVar_ret_20,
+			&&Label_RetVar_ret_24,
+			&&Label_RetVar_ret_28,
+			&&Label_RetVar_ret_32,
+			&&Label_RetVar_ret_n,
+			&&Label_RetVar_void,
+			&&Label_CallNative_void,
+			&&Label_CallNative_ret,
+			&&Label_CallInterp_void,
+			&&Label_CallInterp_ret,
+			&&Label_CallVirtual_void,
+			&&Label_CallVirtual_ret,
+			&&Label_CallInterpVirtual_void,
+			&&Label_CallInterpVirtual_ret,
+			&&Label_CallInd_void,
+			&&Label_CallInd_ret,
+			&&Label_CallDelegate_void,
+			&&Label_CallDelegate_ret,
+			&&Label_NewDelegate,
+			&&Label_BoxVarVar,
+			&&Label_UnBoxVarVar,
+			&&Label_UnBoxAnyVarVar,
+			&&Label_CastclassVar,
+			&&Label_IsInstVar,
+			&&Label_LdtokenVar,
+			&&Label_MakeRefVarVar,
+			&&Label_RefAnyTypeVarVar,
+			&&Label_RefAnyValueVarVar,
+			&&Label_CpobjVarVar_1,
+			&&Label_CpobjVarVar_2,
+			&&Label_CpobjVarVar_4,
+			&&Label_CpobjVarVar_8,
+			&&Label_CpobjVarVar_12,
+			&&Label_CpobjVarVar_16,
+			&&Label_CpobjVarVar_20,
+			&&Label_CpobjVarVar_24,
+			&&Label_CpobjVarVar_28,
+			&&Label_CpobjVarVar_32,
+			&&Label_CpobjVarVar_n_2,
+			&&Label_CpobjVarVar_n_4,
+			&&Label_LdobjVarVar_1,
+			&&Label_LdobjVarVar_2,
+			&&Label_LdobjVarVar_4,
+			&&Label_LdobjVarVar_8,
+			&&Label_LdobjVarVar_12,
+			&&Label_LdobjVarVar_16,
+			&&Label_LdobjVarVar_20,
+			&&Label_LdobjVarVar_24,
+			&&Label_LdobjVarVar_28,
+			&&Label_LdobjVarVar_32,
+			&&Label_LdobjVarVar_n_2,
+			&&Label_LdobjVarVar_n_4,
+			&&Label_StobjVarVar_1,
+			&&Label_StobjVarVar_2,
+			&&Label_StobjVarVar_4,
+			&&Label_StobjVarVar_8,
+			&&Label_StobjVarVar_12,
+			&&Label_StobjVarVar_16,
+			&&Label_StobjVarVar_20,
+			&&Label_StobjVarVar_24,
+			&&Label_StobjVarVar_28,
+			&&Label_StobjVarVar_32,
+			&&Label_StobjVarVar_n_2,
+			&&Label_StobjVarVar_n_4,
+			&&Label_InitobjVar_1,
+			&&Label_InitobjVar_2,
+			&&Label_InitobjVar_4,
+			&&Label_InitobjVar_8,
+			&&Label_InitobjVar_12,
+			&&Label_InitobjVar_16,
+			&&Label_InitobjVar_20,
+			&&Label_InitobjVar_24,
+			&&Label_InitobjVar_28,
+			&&Label_InitobjVar_32,
+			&&Label_InitobjVar_n_2,
+			&&Label_InitobjVar_n_4,
+			&&Label_LdstrVar,
+			&&Label_LdfldVarVar_i1,
+			&&Label_LdfldVarVar_u1,
+			&&Label_LdfldVarVar_i2,
+			&&Label_LdfldVarVar_u2,
+			&&Label_LdfldVarVar_i4,
+			&&Label_LdfldVarVar_u4,
+			&&Label_LdfldVarVar_i8,
+			&&Label_LdfldVarVar_u8,
+			&&Label_LdfldVarVar_size_8,
+			&&Label_LdfldVarVar_size_12,
+			&&Label_LdfldVarVar_size_16,
+			&&Label_LdfldVarVar_size_20,
+			&&Label_LdfldVarVar_size_24,
+			&&Label_LdfldVarVar_size_28,
+			&&Label_LdfldVarVar_size_32,
+			&&Label_LdfldVarVar_n_2,
+			&&Label_LdfldVarVar_n_4,
+			&&Label_LdfldValueTypeVarVar_i1,
+			&&Label_LdfldValueTypeVarVar_u1,
+			&&Label_LdfldValueTypeVarVar_i2,
+			&&Label_LdfldValueTypeVarVar_u2,
+			&&Label_LdfldValueTypeVarVar_i4,
+			&&Label_LdfldValueTypeVarVar_u4,
+			&&Label_LdfldValueTypeVarVar_i8,
+			&&Label_LdfldValueTypeVarVar_u8,
+			&&Label_LdfldValueTypeVarVar_size_8,
+			&&Label_LdfldValueTypeVarVar_size_12,
+			&&Label_LdfldValueTypeVarVar_size_16,
+			&&Label_LdfldValueTypeVarVar_size_20,
+			&&Label_LdfldValueTypeVarVar_size_24,
+			&&Label_LdfldValueTypeVarVar_size_28,
+			&&Label_LdfldValueTypeVarVar_size_32,
+			&&Label_LdfldValueTypeVarVar_n_2,
+			&&Label_LdfldValueTypeVarVar_n_4,
+			&&Label_LdfldaVarVar,
+			&&Label_StfldVarVar_i1,
+			&&Label_StfldVarVar_u1,
+			&&Label_StfldVarVar_i2,
+			&&Label_StfldVarVar_u2,
+			&&Label_StfldVarVar_i4,
+			&&Label_StfldVarVar_u4,
+			&&Label_StfldVarVar_i8,
+			&&Label_StfldVarVar_u8,
+			&&Label_StfldVarVar_size_8,
+			&&Label_StfldVarVar_size_12,
+			&&Label_StfldVarVar_size_16,
+			&&Label_StfldVarVar_size_20,
+			&&Label_StfldVarVar_size_24,
+			&&Label_StfldVarVar_size_28,
+			&&Label_StfldVarVar_size_32,
+			&&Label_StfldVarVar_n_2,
+			&&Label_StfldVarVar_n_4,
+			&&Label_LdsfldVarVar_i1,
+			&&Label_LdsfldVarVar_u1,
+			&&Label_LdsfldVarVar_i2,
+			&&Label_LdsfldVarVar_u2,
+			&&Label_LdsfldVarVar_i4,
+			&&Label_LdsfldVarVar_u4,
+			&&Label_LdsfldVarVar_i8,
+			&&Label_LdsfldVarVar_u8,
+			&&Label_LdsfldVarVar_size_8,
+			&&Label_LdsfldVarVar_size_12,
+			&&Label_LdsfldVarVar_size_16,
+			&&Label_LdsfldVarVar_size_20,
+			&&Label_LdsfldVarVar_size_24,
+			&&Label_LdsfldVarVar_size_28,
+			&&Label_LdsfldVarVar_size_32,
+			&&Label_LdsfldVarVar_n_2,
+			&&Label_LdsfldVarVar_n_4,
+			&&Label_StsfldVarVar_i1,
+			&&Label_StsfldVarVar_u1,
+			&&Label_StsfldVarVar_i2,
+			&&Label_StsfldVarVar_u2,
+			&&Label_StsfldVarVar_i4,
+			&&Label_StsfldVarVar_u4,
+			&&Label_StsfldVarVar_i8,
+			&&Label_StsfldVarVar_u8,
+			&&Label_StsfldVarVar_size_8,
+			&&Label_StsfldVarVar_size_12,
+			&&Label_StsfldVarVar_size_16,
+			&&Label_StsfldVarVar_size_20,
+			&&Label_StsfldVarVar_size_24,
+			&&Label_StsfldVarVar_size_28,
+			&&Label_StsfldVarVar_size_32,
+			&&Label_StsfldVarVar_n_2,
+			&&Label_StsfldVarVar_n_4,
+			&&Label_LdsfldaVarVar,
+			&&Label_LdthreadlocalaVarVar,
+			&&Label_LdthreadlocalVarVar_i1,
+			&&Label_LdthreadlocalVarVar_u1,
+			&&Label_LdthreadlocalVarVar_i2,
+			&&Label_LdthreadlocalVarVar_u2,
+			&&Label_LdthreadlocalVarVar_i4,
+			&&Label_LdthreadlocalVarVar_u4,
+			&&Label_LdthreadlocalVarVar_i8,
+			&&Label_LdthreadlocalVarVar_u8,
+			&&Label_LdthreadlocalVarVar_size_8,
+			&&Label_LdthreadlocalVarVar_size_12,
+			&&Label_LdthreadlocalVarVar_size_16,
+			&&Label_LdthreadlocalVarVar_size_20,
+			&&Label_LdthreadlocalVarVar_size_24,
+			&&Label_LdthreadlocalVarVar_size_28,
+			&&Label_LdthreadlocalVarVar_size_32,
+			&&Label_LdthreadlocalVarVar_n_2,
+			&&Label_LdthreadlocalVarVar_n_4,
+			&&Label_StthreadlocalVarVar_i1,
+			&&Label_StthreadlocalVarVar_u1,
+			&&Label_StthreadlocalVarVar_i2,
+			&&Label_StthreadlocalVarVar_u2,
+			&&Label_StthreadlocalVarVar_i4,
+			&&Label_StthreadlocalVarVar_u4,
+			&&Label_StthreadlocalVarVar_i8,
+			&&Label_StthreadlocalVarVar_u8,
+			&&Label_StthreadlocalVarVar_size_8,
+			&&Label_StthreadlocalVarVar_size_12,
+			&&Label_StthreadlocalVarVar_size_16,
+			&&Label_StthreadlocalVarVar_size_20,
+			&&Label_StthreadlocalVarVar_size_24,
+			&&Label_StthreadlocalVarVar_size_28,
+			&&Label_StthreadlocalVarVar_size_32,
+			&&Label_StthreadlocalVarVar_n_2,
+			&&Label_StthreadlocalVarVar_n_4,
+			&&Label_NewArrVarVar_4,
+			&&Label_NewArrVarVar_8,
+			&&Label_GetArrayLengthVarVar_4,
+			&&Label_GetArrayLengthVarVar_8,
+			&&Label_GetArrayElementAddressAddrVarVar_i4,
+			&&Label_GetArrayElementAddressAddrVarVar_i8,
+			&&Label_GetArrayElementAddressCheckAddrVarVar_i4,
+			&&Label_GetArrayElementAddressCheckAddrVarVar_i8,
+			&&Label_GetArrayElementVarVar_i1_4,
+			&&Label_GetArrayElementVarVar_u1_4,
+			&&Label_GetArrayElementVarVar_i2_4,
+			&&Label_GetArrayElementVarVar_u2_4,
+			&&Label_GetArrayElementVarVar_i4_4,
+			&&Label_GetArrayElementVarVar_u4_4,
+			&&Label_GetArrayElementVarVar_i8_4,
+			&&Label_GetArrayElementVarVar_u8_4,
+			&&Label_GetArrayElementVarVar_size_12_4,
+			&&Label_GetArrayElementVarVar_size_16_4,
+			&&Label_GetArrayElementVarVar_n_4,
+			&&Label_GetArrayElementVarVar_i1_8,
+			&&Label_GetArrayElementVarVar_u1_8,
+			&&Label_GetArrayElementVarVar_i2_8,
+			&&Label_GetArrayElementVarVar_u2_8,
+			&&Label_GetArrayElementVarVar_i4_8,
+			&&Label_GetArrayElementVarVar_u4_8,
+			&&Label_GetArrayElementVarVar_i8_8,
+			&&Label_GetArrayElementVarVar_u8_8,
+			&&Label_GetArrayElementVarVar_size_12_8,
+			&&Label_GetArrayElementVarVar_size_16_8,
+			&&Label_GetArrayElementVarVar_n_8,
+			&&Label_SetArrayElementVarVar_i1_4,
+			&&Label_SetArrayElementVarVar_u1_4,
+			&&Label_SetArrayElementVarVar_i2_4,
+			&&Label_SetArrayElementVarVar_u2_4,
+			&&Label_SetArrayElementVarVar_i4_4,
+			&&Label_SetArrayElementVarVar_u4_4,
+			&&Label_SetArrayElementVarVar_i8_4,
+			&&Label_SetArrayElementVarVar_u8_4,
+			&&Label_SetArrayElementVarVar_ref_4,
+			&&Label_SetArrayElementVarVar_size_12_4,
+			&&Label_SetArrayElementVarVar_size_16_4,
+			&&Label_SetArrayElementVarVar_n_4,
+			&&Label_SetArrayElementVarVar_i1_8,
+			&&Label_SetArrayElementVarVar_u1_8,
+			&&Label_SetArrayElementVarVar_i2_8,
+			&&Label_SetArrayElementVarVar_u2_8,
+			&&Label_SetArrayElementVarVar_i4_8,
+			&&Label_SetArrayElementVarVar_u4_8,
+			&&Label_SetArrayElementVarVar_i8_8,
+			&&Label_SetArrayElementVarVar_u8_8,
+			&&Label_SetArrayElementVarVar_ref_8,
+			&&Label_SetArrayElementVarVar_size_12_8,
+			&&Label_SetArrayElementVarVar_size_16_8,
+			&&Label_SetArrayElementVarVar_n_8,
+			&&Label_SetArrayElementObjectCheckVarVar_4,
+			&&Label_SetArrayElementObjectCheckVarVar_8,
+			&&Label_NewMdArrVarVar_length,
+			&&Label_NewMdArrVarVar_length_bound,
+			&&Label_GetMdArrElementVarVar,
+			&&Label_GetMdArrElementAddressVarVar,
+			&&Label_SetMdArrElementVarVar,
+			&&Label_ThrowEx,
+			&&Label_RethrowEx,
+			&&Label_LeaveEx,
+			&&Label_EndFilterEx,
+			&&Label_EndFinallyEx,
+			&&Label_NullableNewVarVar,
+			&&Label_NullableCtorVarVar,
+			&&Label_NullableHasValueVar,
+			&&Label_NullableGetValueOrDefaultVarVar,
+			&&Label_NullableGetValueOrDefaultVarVar_1,
+			&&Label_NullableGetValueVarVar,
+			&&Label_InterlockedCompareExchangeVarVarVarVar_i4,
+			&&Label_InterlockedCompareExchangeVarVarVarVar_i8,
+			&&Label_InterlockedCompareExchangeVarVarVarVar_pointer,
+			&&Label_InterlockedExchangeVarVarVar_i4,
+			&&Label_InterlockedExchangeVarVarVar_i8,
+			&&Label_InterlockedExchangeVarVarVar_pointer,
+			&&Label_NewSystemObjectVar,
+			&&Label_NewVector2VarVarVar,
+			&&Label_NewVector3VarVarVarVar,
+			&&Label_NewVector4VarVarVarVarVar,
+			&&Label_BranchVarArrayLength_Clt_i4,
+			&&Label_BranchVarArrayLength_Cge_i4,
+			&&Label_BinOpVarVarFld_Add_i4,
+			&&Label_BinOpVarVarFld_Add_i8,
+			&&Label_BinOpVarVarFld_Add_f4,
+			&&Label_BinOpVarVarFld_Add_f8,
+			&&Label_BinOpVarVarFld_Sub_i4,
+			&&Label_BinOpVarVarFld_Sub_i8,
+			&&Label_BinOpVarVarFld_Sub_f4,
+			&&Label_BinOpVarVarFld_Sub_f8,
+			&&Label_BinOpVarVarFld_Mul_i4,
+			&&Label_BinOpVarVarFld_Mul_i8,
+			&&Label_BinOpVarVarFld_Mul_f4,
+			&&Label_BinOpVarVarFld_Mul_f8,
+			&&Label_LdftnVar,
+			&&Label_LdsfldInitedVarVar_i1,
+			&&Label_LdsfldInitedVarVar_u1,
+			&&Label_LdsfldInitedVarVar_i2,
+			&&Label_LdsfldInitedVarVar_u2,
+			&&Label_LdsfldInitedVarVar_i4,
+			&&Label_LdsfldInitedVarVar_u4,
+			&&Label_LdsfldInitedVarVar_i8,
+			&&Label_LdsfldInitedVarVar_u8,
+			&&Label_LdsfldInitedVarVar_size_8,
+			&&Label_LdsfldInitedVarVar_size_12,
+			&&Label_LdsfldInitedVarVar_size_16,
+			&&Label_LdsfldInitedVarVar_size_20,
+			&&Label_LdsfldInitedVarVar_size_24,
+			&&Label_LdsfldInitedVarVar_size_28,
+			&&Label_LdsfldInitedVarVar_size_32,
+			&&Label_LdsfldInitedVarVar_n_2,
+			&&Label_LdsfldInitedVarVar_n_4,
+			&&Label_StsfldInitedVarVar_i1,
+			&&Label_StsfldInitedVarVar_u1,
+			&&Label_StsfldInitedVarVar_i2,
+			&&Label_StsfldInitedVarVar_u2,
+			&&Label_StsfldInitedVarVar_i4,
+			&&Label_StsfldInitedVarVar_u4,
+			&&Label_StsfldInitedVarVar_i8,
+			&&Label_StsfldInitedVarVar_u8,
+			&&Label_StsfldInitedVarVar_size_8,
+			&&Label_StsfldInitedVarVar_size_12,
+			&&Label_StsfldInitedVarVar_size_16,
+			&&Label_StsfldInitedVarVar_size_20,
+			&&Label_StsfldInitedVarVar_size_24,
+			&&Label_StsfldInitedVarVar_size_28,
+			&&Label_StsfldInitedVarVar_size_32,
+			&&Label_StsfldInitedVarVar_n_2,
+			&&Label_StsfldInitedVarVar_n_4,
+			&&Label_LdsfldaInitedVarVar,
+			&&Label_LdthreadlocalaInitedVarVar,
+			&&Label_LdthreadlocalInitedVarVar_i1,
+			&&Label_LdthreadlocalInitedVarVar_u1,
+			&&Label_LdthreadlocalInitedVarVar_i2,
+			&&Label_LdthreadlocalInitedVarVar_u2,
+			&&Label_LdthreadlocalInitedVarVar_i4,
+			&&Label_LdthreadlocalInitedVarVar_u4,
+			&&Label_LdthreadlocalInitedVarVar_i8,
+			&&Label_LdthreadlocalInitedVarVar_u8,
+			&&Label_LdthreadlocalInitedVarVar_size_8,
+			&&Label_LdthreadlocalInitedVarVar_size_12,
+			&&Label_LdthreadlocalInitedVarVar_size_16,
+			&&Label_LdthreadlocalInitedVarVar_size_20,
+			&&Label_LdthreadlocalInitedVarVar_size_24,
+			&&Label_LdthreadlocalInitedVarVar_size_28,
+			&&Label_LdthreadlocalInitedVarVar_size_32,
+			&&Label_LdthreadlocalInitedVarVar_n_2,
+			&&Label_LdthreadlocalInitedVarVar_n_4,
+			&&Label_StthreadlocalInitedVarVar_i1,
+			&&Label_StthreadlocalInitedVarVar_u1,
+			&&Label_StthreadlocalInitedVarVar_i2,
+			&&Label_StthreadlocalInitedVarVar_u2,
+			&&Label_StthreadlocalInitedVarVar_i4,
+			&&Label_StthreadlocalInitedVarVar_u4,
+			&&Label_StthreadlocalInitedVarVar_i8,
+			&&Label_StthreadlocalInitedVarVar_u8,
+			&&Label_StthreadlocalInitedVarVar_size_8,
+			&&Label_StthreadlocalInitedVarVar_size_12,
+			&&Label_StthreadlocalInitedVarVar_size_16,
+			&&Label_StthreadlocalInitedVarVar_size_20,
+			&&Label_StthreadlocalInitedVarVar_size_24,
+			&&Label_StthreadlocalInitedVarVar_size_28,
+			&&Label_StthreadlocalInitedVarVar_size_32,
+			&&Label_StthreadlocalInitedVarVar_n_2,
+			&&Label_StthreadlocalInitedVarVar_n_4,
+			&&Label_MathAbsVarVar_i4,
+			&&Label_MathAbsVarVar_i8,
+			&&Label_MathAbsVarVar_f4,
+			&&Label_MathAbsVarVar_f8,
+			&&Label_MathMinVarVarVar_i4,
+			&&Label_MathMinVarVarVar_i8,
+			&&Label_MathMinVarVarVar_f4,
+			&&Label_MathMinVarVarVar_f8,
+			&&Label_MathMaxVarVarVar_i4,
+			&&Label_MathMaxVarVarVar_i8,
+			&&Label_MathMaxVarVarVar_f4,
+			&&Label_MathMaxVarVarVar_f8,
+			&&Label_MathSqrtVarVar_f4,
+			&&Label_MathSqrtVarVar_f8,
+			&&Label_MathFloorVarVar_f4,
+			&&Label_MathFloorVarVar_f8,
+			&&Label_MathClampVarVarVarVar_i4,
+			&&Label_MathClampVarVarVarVar_i8,
+			&&Label_MathClampVarVarVarVar_f4,
+			&&Label_MathClampVarVarVarVar_f8,
+			&&Label_ArrayGetLengthVarVar,
+			&&Label_StringGetLengthVarVar,
+			&&Label_StringGetCharsVarVarVar,
+			&&Label_Vector2AddVarVarVar,
+			&&Label_Vector2SubVarVarVar,
+			&&Label_Vector2NegVarVar,
+			&&Label_Vector2MulScalarVarVarVar,
+			&&Label_Vector2DivScalarVarVarVar,
+			&&Label_Vector2DotVarVarVar,
+			&&Label_Vector2MagnitudeVarVar,
+			&&Label_Vector2SqrMagnitudeVarVar,
+			&&Label_Vector2NormalizedVarVar,
+			&&Label_Vector2NormalizeVar,
+			&&Label_Vector3AddVarVarVar,
+			&&Label_Vector3SubVarVarVar,
+			&&Label_Vector3NegVarVar,
+			&&Label_Vector3MulScalarVarVarVar,
+			&&Label_Vector3DivScalarVarVarVar,
+			&&Label_Vector3DotVarVarVar,
+			&&Label_Vector3MagnitudeVarVar,
+			&&Label_Vector3SqrMagnitudeVarVar,
+			&&Label_Vector3NormalizedVarVar,
+			&&Label_Vector3NormalizeVar,
+			&&Label_Vector4AddVarVarVar,
+			&&Label_Vector4SubVarVarVar,
+			&&Label_Vector4NegVarVar,
+			&&Label_Vector4MulScalarVarVarVar,
+			&&Label_Vector4DivScalarVarVarVar,
+			&&Label_Vector4DotVarVarVar,
+			&&Label_Vector4MagnitudeVarVar,
+			&&Label_Vector4SqrMagnitudeVarVar,
+			&&Label_Vector4NormalizedVarVar,
+			&&Label_Vector4NormalizeVar,
+			&&Label_Vector3CrossVarVarVar,
+			&&Label_QuaternionMulVarVarVar,
+			&&Label_QuaternionMulVector3VarVarVar,
+			&&Label_QuaternionDotVarVarVar,
+			&&Label_TierUpLoopHeader,
+			&&Label_OsrLoopHeader,
+			//!!!}}DISPATCH
+		};
+		static_assert(sizeof(s_dispatchTable) / sizeof(s_dispatchTable[0]) == (size_t)HiOpcodeEnum::__Count, "dispatch table must cover all opcodes");
+#endif
+
 		const InterpMethodInfo* imi;
 		InterpFrame* frame;
 		StackObject* localVarBase;
 		byte* ipBase;
 		byte* ip;
 
-		PREPARE_NEW_FRAME(methodInfo, args, ret, false);
+		PREPARE_NEW_FRAME(methodInfo, args, ret, FrameArgMode::Native);
 
 		// exception handler
 		Il2CppException* curException = nullptr;
@@ -895,248 +1834,248 @@ else \
 		{
 			for (;;)
 			{
-				switch (*(HiOpcodeEnum*)ip)
+				HI_DISPATCH_BEGIN()
 				{
 #pragma region memory
 					//!!!{{MEMORY
-				case HiOpcodeEnum::InitLocals_n_2:
+				HI_OPCODE_CASE(InitLocals_n_2):
 				{
 					uint16_t __size = *(uint16_t*)(ip + 2);
 					InitDefaultN(localVarBase + imi->localVarBaseOffset, __size);
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitLocals_n_4:
+				HI_OPCODE_CASE(InitLocals_n_4):
 				{
 					uint32_t __size = *(uint32_t*)(ip + 2);
 					InitDefaultN(localVarBase + imi->localVarBaseOffset, __size);
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocVarVar:
+				HI_OPCODE_CASE(LdlocVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocVarVarSize:
+				HI_OPCODE_CASE(LdlocVarVarSize):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((void*)(localVarBase + __dst), (void*)(localVarBase + __src), __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocVarAddress:
+				HI_OPCODE_CASE(LdlocVarAddress):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(void**)(localVarBase + __dst)) = (void*)(localVarBase + __src);
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_1:
+				HI_OPCODE_CASE(LdcVarConst_1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint8_t __src = *(uint8_t*)(ip + 4);
 					uint8_t ____pad__ = *(uint8_t*)(ip + 0);
 					(*(int32_t*)(localVarBase + __dst)) = __src;
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_2:
+				HI_OPCODE_CASE(LdcVarConst_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = __src;
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_4:
+				HI_OPCODE_CASE(LdcVarConst_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint32_t __src = *(uint32_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = __src;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_8:
+				HI_OPCODE_CASE(LdcVarConst_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint64_t __src = *(uint64_t*)(ip + 4);
 					(*(uint64_t*)(localVarBase + __dst)) = __src;
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdnullVar:
+				HI_OPCODE_CASE(LdnullVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					(*(void**)(localVarBase + __dst)) = nullptr;
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i1:
+				HI_OPCODE_CASE(LdindVarVar_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int8_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_u1:
+				HI_OPCODE_CASE(LdindVarVar_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint8_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i2:
+				HI_OPCODE_CASE(LdindVarVar_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int16_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_u2:
+				HI_OPCODE_CASE(LdindVarVar_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint16_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i4:
+				HI_OPCODE_CASE(LdindVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int32_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_u4:
+				HI_OPCODE_CASE(LdindVarVar_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint32_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i8:
+				HI_OPCODE_CASE(LdindVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (*(int64_t*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_f4:
+				HI_OPCODE_CASE(LdindVarVar_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (*(float*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_f8:
+				HI_OPCODE_CASE(LdindVarVar_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (*(double*)*(void**)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i1:
+				HI_OPCODE_CASE(StindVarVar_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int8_t*)*(void**)(localVarBase + __dst)) = (*(int8_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i2:
+				HI_OPCODE_CASE(StindVarVar_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int16_t*)*(void**)(localVarBase + __dst)) = (*(int16_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i4:
+				HI_OPCODE_CASE(StindVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)*(void**)(localVarBase + __dst)) = (*(int32_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i8:
+				HI_OPCODE_CASE(StindVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)*(void**)(localVarBase + __dst)) = (*(int64_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_f4:
+				HI_OPCODE_CASE(StindVarVar_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)*(void**)(localVarBase + __dst)) = (*(float*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_f8:
+				HI_OPCODE_CASE(StindVarVar_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)*(void**)(localVarBase + __dst)) = (*(double*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LocalAllocVarVar_n_2:
+				HI_OPCODE_CASE(LocalAllocVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 					(*(void**)(localVarBase + __dst)) = LOCAL_ALLOC((*(uint16_t*)(localVarBase + __size)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LocalAllocVarVar_n_4:
+				HI_OPCODE_CASE(LocalAllocVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 					(*(void**)(localVarBase + __dst)) = LOCAL_ALLOC((*(uint32_t*)(localVarBase + __size)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitblkVarVarVar:
+				HI_OPCODE_CASE(InitblkVarVarVar):
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memset((*(void**)(localVarBase + __addr)), (*(uint8_t*)(localVarBase + __value)), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpblkVarVar:
+				HI_OPCODE_CASE(CpblkVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::MemoryBarrier:
+				HI_OPCODE_CASE(MemoryBarrier):
 				{
 					MEMORY_BARRIER();
 				    ip += 2;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}MEMORY
@@ -1146,2005 +2085,2005 @@ else \
 
 #pragma region CONVERT
 		//!!!{{CONVERT
-				case HiOpcodeEnum::ConvertVarVar_i1_i1:
+				HI_OPCODE_CASE(ConvertVarVar_i1_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_u1:
+				HI_OPCODE_CASE(ConvertVarVar_i1_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_i2:
+				HI_OPCODE_CASE(ConvertVarVar_i1_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_u2:
+				HI_OPCODE_CASE(ConvertVarVar_i1_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_i4:
+				HI_OPCODE_CASE(ConvertVarVar_i1_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_u4:
+				HI_OPCODE_CASE(ConvertVarVar_i1_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_i8:
+				HI_OPCODE_CASE(ConvertVarVar_i1_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_u8:
+				HI_OPCODE_CASE(ConvertVarVar_i1_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_f4:
+				HI_OPCODE_CASE(ConvertVarVar_i1_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i1_f8:
+				HI_OPCODE_CASE(ConvertVarVar_i1_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_i1:
+				HI_OPCODE_CASE(ConvertVarVar_u1_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_u1:
+				HI_OPCODE_CASE(ConvertVarVar_u1_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_i2:
+				HI_OPCODE_CASE(ConvertVarVar_u1_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_u2:
+				HI_OPCODE_CASE(ConvertVarVar_u1_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_i4:
+				HI_OPCODE_CASE(ConvertVarVar_u1_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_u4:
+				HI_OPCODE_CASE(ConvertVarVar_u1_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_i8:
+				HI_OPCODE_CASE(ConvertVarVar_u1_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_u8:
+				HI_OPCODE_CASE(ConvertVarVar_u1_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_f4:
+				HI_OPCODE_CASE(ConvertVarVar_u1_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u1_f8:
+				HI_OPCODE_CASE(ConvertVarVar_u1_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_i1:
+				HI_OPCODE_CASE(ConvertVarVar_i2_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_u1:
+				HI_OPCODE_CASE(ConvertVarVar_i2_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_i2:
+				HI_OPCODE_CASE(ConvertVarVar_i2_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_u2:
+				HI_OPCODE_CASE(ConvertVarVar_i2_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_i4:
+				HI_OPCODE_CASE(ConvertVarVar_i2_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_u4:
+				HI_OPCODE_CASE(ConvertVarVar_i2_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_i8:
+				HI_OPCODE_CASE(ConvertVarVar_i2_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_u8:
+				HI_OPCODE_CASE(ConvertVarVar_i2_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_f4:
+				HI_OPCODE_CASE(ConvertVarVar_i2_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i2_f8:
+				HI_OPCODE_CASE(ConvertVarVar_i2_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_i1:
+				HI_OPCODE_CASE(ConvertVarVar_u2_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_u1:
+				HI_OPCODE_CASE(ConvertVarVar_u2_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_i2:
+				HI_OPCODE_CASE(ConvertVarVar_u2_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_u2:
+				HI_OPCODE_CASE(ConvertVarVar_u2_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_i4:
+				HI_OPCODE_CASE(ConvertVarVar_u2_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_u4:
+				HI_OPCODE_CASE(ConvertVarVar_u2_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_i8:
+				HI_OPCODE_CASE(ConvertVarVar_u2_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_u8:
+				HI_OPCODE_CASE(ConvertVarVar_u2_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_f4:
+				HI_OPCODE_CASE(ConvertVarVar_u2_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u2_f8:
+				HI_OPCODE_CASE(ConvertVarVar_u2_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i1:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u1:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i2:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u2:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i4:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u4:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i8:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u8:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_f4:
+				HI_OPCODE_CASE(ConvertVarVar_i4_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_f8:
+				HI_OPCODE_CASE(ConvertVarVar_i4_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i1:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u1:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i2:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u2:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i4:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u4:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i8:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u8:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_f4:
+				HI_OPCODE_CASE(ConvertVarVar_u4_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_f8:
+				HI_OPCODE_CASE(ConvertVarVar_u4_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i1:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u1:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i2:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u2:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i4:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u4:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i8:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u8:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_f4:
+				HI_OPCODE_CASE(ConvertVarVar_i8_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_f8:
+				HI_OPCODE_CASE(ConvertVarVar_i8_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i1:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u1:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i2:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u2:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i4:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u4:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i8:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u8:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_f4:
+				HI_OPCODE_CASE(ConvertVarVar_u8_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_f8:
+				HI_OPCODE_CASE(ConvertVarVar_u8_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i1:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u1:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i2:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u2:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i4:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u4:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i8:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u8:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_f4:
+				HI_OPCODE_CASE(ConvertVarVar_f4_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_f8:
+				HI_OPCODE_CASE(ConvertVarVar_f4_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i1:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u1:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i2:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u2:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i4:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u4:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i8:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u8:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_f4:
+				HI_OPCODE_CASE(ConvertVarVar_f8_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_f8:
+				HI_OPCODE_CASE(ConvertVarVar_f8_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)((*(int8_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)((*(int8_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(int16_t)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(uint16_t)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(int32_t)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(uint32_t)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(int64_t)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(uint64_t)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(float)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i1_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i1_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)(double)((*(int8_t*)(localVarBase + __src))) != (*(int8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(int8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)((*(uint8_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int8_t)((*(uint8_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(int16_t)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(uint16_t)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(int32_t)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(uint32_t)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(int64_t)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(uint64_t)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(float)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u1_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u1_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint8_t)(double)((*(uint8_t*)(localVarBase + __src))) != (*(uint8_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(uint8_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(int8_t)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(uint8_t)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)((*(int16_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)((*(int16_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(int32_t)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(uint32_t)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(int64_t)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(uint64_t)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(float)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i2_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i2_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)(double)((*(int16_t*)(localVarBase + __src))) != (*(int16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(int16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(int8_t)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(uint8_t)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)((*(uint16_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int16_t)((*(uint16_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(int32_t)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(uint32_t)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(int64_t)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(uint64_t)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(float)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u2_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u2_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint16_t)(double)((*(uint16_t*)(localVarBase + __src))) != (*(uint16_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(uint16_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(int8_t)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(uint8_t)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(int16_t)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(uint16_t)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)((*(int32_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)((*(int32_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(int64_t)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(uint64_t)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(float)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)(double)((*(int32_t*)(localVarBase + __src))) != (*(int32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(int32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(int8_t)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(uint8_t)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(int16_t)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(uint16_t)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)((*(uint32_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)((*(uint32_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(int64_t)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(uint64_t)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(float)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint32_t)(double)((*(uint32_t*)(localVarBase + __src))) != (*(uint32_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(int8_t)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(uint8_t)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(int16_t)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(uint16_t)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(int32_t)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(uint32_t)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)((*(int64_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)((*(int64_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(float)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)(double)((*(int64_t*)(localVarBase + __src))) != (*(int64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(int64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(int8_t)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(uint8_t)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(int16_t)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(uint16_t)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(int32_t)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(uint32_t)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)((*(uint64_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)((*(uint64_t*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(float)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((uint64_t)(double)((*(uint64_t*)(localVarBase + __src))) != (*(uint64_t*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(int8_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(uint8_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(int16_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(uint16_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(int32_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(uint32_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(int64_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(uint64_t)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int32_t)((*(float*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((float)(double)((*(float*)(localVarBase + __src))) != (*(float*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(float*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(int8_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int8_t*)(localVarBase + __dst)) = (int8_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(uint8_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint8_t*)(localVarBase + __dst)) = (uint8_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(int16_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int16_t*)(localVarBase + __dst)) = (int16_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(uint16_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint16_t*)(localVarBase + __dst)) = (uint16_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(int32_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(uint32_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint32_t*)(localVarBase + __dst)) = (uint32_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(int64_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(uint64_t)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(uint64_t*)(localVarBase + __dst)) = (uint64_t)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_f4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((double)(float)((*(double*)(localVarBase + __src))) != (*(double*)(localVarBase + __src)))
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(float*)(localVarBase + __dst)) = (float)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_f8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    if ((int64_t)((*(double*)(localVarBase + __src))) < 0)
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    (*(double*)(localVarBase + __dst)) = (double)((*(double*)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}CONVERT
@@ -3152,295 +4091,295 @@ else \
 
 #pragma region ARITH
 		//!!!{{ARITH
-				case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) - (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) * (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_MulUn_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_MulUn_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiMulUn((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiDiv((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_DivUn_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_DivUn_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiDivUn((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiRem((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_RemUn_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_RemUn_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiRemUn((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_And_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_And_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) & (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Or_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Or_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) | (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Xor_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Xor_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) ^ (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Add_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) + (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) - (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) * (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_MulUn_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_MulUn_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiMulUn((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiDiv((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_DivUn_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_DivUn_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiDivUn((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiRem((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_RemUn_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_RemUn_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiRemUn((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_And_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_And_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) & (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Or_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Or_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) | (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Xor_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Xor_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) ^ (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) + (*(float*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) - (*(float*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) * (*(float*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = HiDiv((*(float*)(localVarBase + __op1)), (*(float*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = HiRem((*(float*)(localVarBase + __op1)), (*(float*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Add_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) + (*(double*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) - (*(double*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) * (*(double*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = HiDiv((*(double*)(localVarBase + __op1)), (*(double*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = HiRem((*(double*)(localVarBase + __op1)), (*(double*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3453,12 +4392,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3471,12 +4410,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3489,12 +4428,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3507,12 +4446,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3525,12 +4464,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3543,12 +4482,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_u4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3561,12 +4500,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_u4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3579,12 +4518,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_u4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3597,12 +4536,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_u8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3615,12 +4554,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_u8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3633,12 +4572,12 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_u8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3651,180 +4590,324 @@ else \
 				    }
 				    else
 				    {
-				        il2cpp::vm::Exception::RaiseOverflowException();
+				        RAISE_EX(il2cpp::vm::Exception::GetOverflowException());
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i4_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) << (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i4_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) >> (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i4_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiShrUn((*(int32_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i4_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) << (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i4_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) >> (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i4_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiShrUn((*(int32_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i8_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) << (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i8_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) >> (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i8_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiShrUn((*(int64_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i8_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) << (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i8_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) >> (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i8_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiShrUn((*(int64_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_i4:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = - (*(int32_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Not_i4:
+				HI_OPCODE_CASE(UnaryOpVarVar_Not_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = ~ (*(int32_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_i8:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = - (*(int64_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Not_i8:
+				HI_OPCODE_CASE(UnaryOpVarVar_Not_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = ~ (*(int64_t*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_f4:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = - (*(float*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_f8:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = - (*(double*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CheckFiniteVar_f4:
+				HI_OPCODE_CASE(CheckFiniteVar_f4):
 				{
 					uint16_t __src = *(uint16_t*)(ip + 2);
 					HiCheckFinite((*(float*)(localVarBase + __src)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CheckFiniteVar_f8:
+				HI_OPCODE_CASE(CheckFiniteVar_f8):
 				{
 					uint16_t __src = *(uint16_t*)(ip + 2);
 					HiCheckFinite((*(double*)(localVarBase + __src)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Add_i4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + *(int32_t*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Add_i8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) + *(int64_t*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Add_f4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) + *(float*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Add_f8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) + *(double*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Sub_i4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) - *(int32_t*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Sub_i8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) - *(int64_t*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Sub_f4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) - *(float*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Sub_f8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) - *(double*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Mul_i4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) * *(int32_t*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Mul_i8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) * *(int64_t*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Mul_f4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) * *(float*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarFld_Mul_f8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __obj = *(uint16_t*)(ip + 6);
+					uint16_t __offset = *(uint16_t*)(ip + 8);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    CHECK_NOT_NULL_EX(_obj);
+				    (*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) * *(double*)((uint8_t*)_obj + __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}ARITH
@@ -3832,185 +4915,185 @@ else \
 
 #pragma region COMPARE
 		//!!!{{COMPARE
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_i4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_i8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_f4):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_f8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}COMPARE
@@ -4018,13 +5101,13 @@ else \
 
 #pragma region BRANCH
 		//!!!{{BRANCH
-				case HiOpcodeEnum::BranchUncondition_4:
+				HI_OPCODE_CASE(BranchUncondition_4):
 				{
 					int32_t __offset = *(int32_t*)(ip + 2);
 					ip = ipBase + __offset;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchTrueVar_i4:
+				HI_OPCODE_CASE(BranchTrueVar_i4):
 				{
 					uint16_t __op = *(uint16_t*)(ip + 2);
 					int32_t __offset = *(int32_t*)(ip + 4);
@@ -4036,9 +5119,9 @@ else \
 				    {
 				        ip += 8;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchTrueVar_i8:
+				HI_OPCODE_CASE(BranchTrueVar_i8):
 				{
 					uint16_t __op = *(uint16_t*)(ip + 2);
 					int32_t __offset = *(int32_t*)(ip + 4);
@@ -4050,9 +5133,9 @@ else \
 				    {
 				        ip += 8;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchFalseVar_i4:
+				HI_OPCODE_CASE(BranchFalseVar_i4):
 				{
 					uint16_t __op = *(uint16_t*)(ip + 2);
 					int32_t __offset = *(int32_t*)(ip + 4);
@@ -4064,9 +5147,9 @@ else \
 				    {
 				        ip += 8;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchFalseVar_i8:
+				HI_OPCODE_CASE(BranchFalseVar_i8):
 				{
 					uint16_t __op = *(uint16_t*)(ip + 2);
 					int32_t __offset = *(int32_t*)(ip + 4);
@@ -4078,9 +5161,9 @@ else \
 				    {
 				        ip += 8;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_i4:
+				HI_OPCODE_CASE(BranchVarVar_Ceq_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4093,9 +5176,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_i8:
+				HI_OPCODE_CASE(BranchVarVar_Ceq_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4108,9 +5191,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_f4:
+				HI_OPCODE_CASE(BranchVarVar_Ceq_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4123,9 +5206,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_f8:
+				HI_OPCODE_CASE(BranchVarVar_Ceq_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4138,9 +5221,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4153,9 +5236,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4168,9 +5251,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4183,9 +5266,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4198,9 +5281,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4213,9 +5296,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_i8:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4228,9 +5311,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_f4:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4243,9 +5326,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_f8:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4258,9 +5341,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4273,9 +5356,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4288,9 +5371,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4303,9 +5386,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4318,9 +5401,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_i4:
+				HI_OPCODE_CASE(BranchVarVar_Cge_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4333,9 +5416,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_i8:
+				HI_OPCODE_CASE(BranchVarVar_Cge_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4348,9 +5431,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_f4:
+				HI_OPCODE_CASE(BranchVarVar_Cge_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4363,9 +5446,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_f8:
+				HI_OPCODE_CASE(BranchVarVar_Cge_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4378,9 +5461,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4393,9 +5476,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4408,9 +5491,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4423,9 +5506,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4438,9 +5521,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_i4:
+				HI_OPCODE_CASE(BranchVarVar_Clt_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4453,9 +5536,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_i8:
+				HI_OPCODE_CASE(BranchVarVar_Clt_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4468,9 +5551,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_f4:
+				HI_OPCODE_CASE(BranchVarVar_Clt_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4483,9 +5566,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_f8:
+				HI_OPCODE_CASE(BranchVarVar_Clt_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4498,9 +5581,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4513,9 +5596,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4528,9 +5611,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4543,9 +5626,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4558,9 +5641,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_i4:
+				HI_OPCODE_CASE(BranchVarVar_Cle_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4573,9 +5656,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_i8:
+				HI_OPCODE_CASE(BranchVarVar_Cle_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4588,9 +5671,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_f4:
+				HI_OPCODE_CASE(BranchVarVar_Cle_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4603,9 +5686,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_f8:
+				HI_OPCODE_CASE(BranchVarVar_Cle_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4618,9 +5701,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_i4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4633,9 +5716,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_i8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4648,9 +5731,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_f4):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4663,9 +5746,9 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_f8):
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4678,16 +5761,16 @@ else \
 				    {
 				        ip += 10;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchJump:
+				HI_OPCODE_CASE(BranchJump):
 				{
 					uint32_t __token = *(uint32_t*)(ip + 2);
 					IL2CPP_ASSERT(false);
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchSwitch:
+				HI_OPCODE_CASE(BranchSwitch):
 				{
 				    uint16_t __value = *(uint16_t*)(ip + 2);
 				    uint32_t __caseNum = *(uint32_t*)(ip + 4);
@@ -4701,7 +5784,69 @@ else \
 				    {
 				        ip += 12;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarArrayLength_Clt_i4):
+				{
+					uint16_t __op = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					int32_t __offset = *(int32_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_EX(arr);
+				    if (CompareClt((*(int32_t*)(localVarBase + __op)), (int32_t)il2cpp::vm::Array::GetLength(arr)))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 10;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarArrayLength_Cge_i4):
+				{
+					uint16_t __op = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					int32_t __offset = *(int32_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_EX(arr);
+				    if (CompareCge((*(int32_t*)(localVarBase + __op)), (int32_t)il2cpp::vm::Array::GetLength(arr)))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 10;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(TierUpLoopHeader):
+				{
+				    if (++imi->backEdgeCount == InterpreterModule::GetTierUpBackEdgeThreshold())
+				    {
+				        InterpreterModule::TierUpMethod(imi);
+				    }
+				    ip += 2;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(OsrLoopHeader):
+				{
+					int32_t __ilOffset = *(int32_t*)(ip + 2);
+				    if (++imi->backEdgeCount >= InterpreterModule::GetTierUpBackEdgeThreshold())
+				    {
+				        byte* _osrIp = TryEnterOptimizedLoop(interpFrameGroup, frame, __ilOffset);
+				        if (_osrIp)
+				        {
+				            imi = frame->method;
+				            ipBase = imi->codes;
+				            ip = _osrIp;
+				            HI_DISPATCH_NEXT();
+				        }
+				        // 替换失败后重新计数,再过一个阈值的循环次数才重试,避免每次循环都走慢路径
+				        imi->backEdgeCount = 0;
+				    }
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}BRANCH
@@ -4709,7 +5854,7 @@ else \
 
 #pragma region FUNCTION
 		//!!!{{FUNCTION
-				case HiOpcodeEnum::NewClassVar:
+				HI_OPCODE_CASE(NewClassVar):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					void* __managed2NativeMethod = *(void**)(ip + 4);
@@ -4721,9 +5866,9 @@ else \
 				    ((Managed2NativeCallMethod)__managed2NativeMethod)(__method, _argIdxs, localVarBase, nullptr);
 				    (*(Il2CppObject**)(localVarBase + __obj)) = _obj;
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassVar_Ctor_0:
+				HI_OPCODE_CASE(NewClassVar_Ctor_0):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = *(MethodInfo**)(ip + 4);
@@ -4731,17 +5876,17 @@ else \
 				    ((NativeClassCtor0)(__method->methodPointer))(_obj, __method);
 				    (*(Il2CppObject**)(localVarBase + __obj)) = _obj;
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassVar_NotCtor:
+				HI_OPCODE_CASE(NewClassVar_NotCtor):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 				    (*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::New(__klass);
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewValueTypeVar:
+				HI_OPCODE_CASE(NewValueTypeVar):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					void* __managed2NativeMethod = *(void**)(ip + 4);
@@ -4757,9 +5902,9 @@ else \
 				    ((Managed2NativeCallMethod)__managed2NativeMethod)(__method, _argIdxs, localVarBase, nullptr);
 				    std::memcpy((void*)(localVarBase + __obj), _this, _typeSize);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassInterpVar:
+				HI_OPCODE_CASE(NewClassInterpVar):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = *(MethodInfo**)(ip + 4);
@@ -4773,9 +5918,9 @@ else \
 				    _frameBasePtr->obj = _newObj; // prepare this 
 				    (*(Il2CppObject**)(localVarBase + __obj)) = _newObj; // set must after move
 				    CALL_INTERP((ip + 18), __method, _frameBasePtr, nullptr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassInterpVar_Ctor_0:
+				HI_OPCODE_CASE(NewClassInterpVar_Ctor_0):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = *(MethodInfo**)(ip + 4);
@@ -4786,9 +5931,9 @@ else \
 				    _frameBasePtr->obj = _newObj; // prepare this 
 				    (*(Il2CppObject**)(localVarBase + __obj)) = _newObj;
 				    CALL_INTERP((ip + 14), __method, _frameBasePtr, nullptr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewValueTypeInterpVar:
+				HI_OPCODE_CASE(NewValueTypeInterpVar):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = *(MethodInfo**)(ip + 4);
@@ -4802,106 +5947,106 @@ else \
 				    int32_t _typeSize = GetTypeValueSize(__method->klass);
 				    InitDefaultN((void*)(localVarBase + __obj), _typeSize); // init after move
 				    CALL_INTERP((ip + 18), __method, _frameBasePtr, nullptr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::AdjustValueTypeRefVar:
+				HI_OPCODE_CASE(AdjustValueTypeRefVar):
 				{
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    // ref => fake value type boxed object value. // fake obj = ref(value_type) - sizeof(Il2CppObject)
 				    ((StackObject*)((void*)(localVarBase + __data)))->obj -= 1;
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BoxRefVarVar:
+				HI_OPCODE_CASE(BoxRefVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
 				    (*(Il2CppObject**)(localVarBase + __dst)) = il2cpp::vm::Object::Box(__klass, (*(void**)(localVarBase + __src)));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdvirftnVarVar:
+				HI_OPCODE_CASE(LdvirftnVarVar):
 				{
 					uint16_t __resultMethod = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					MethodInfo* __virtualMethod = *(MethodInfo**)(ip + 6);
 				    (*(MethodInfo**)(localVarBase + __resultMethod)) = GET_OBJECT_VIRTUAL_METHOD((*(Il2CppObject**)(localVarBase + __obj)), __virtualMethod);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_8:
+				HI_OPCODE_CASE(RetVar_ret_8):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy8(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_12:
+				HI_OPCODE_CASE(RetVar_ret_12):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy12(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_16:
+				HI_OPCODE_CASE(RetVar_ret_16):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy16(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_20:
+				HI_OPCODE_CASE(RetVar_ret_20):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy20(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_24:
+				HI_OPCODE_CASE(RetVar_ret_24):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy24(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_28:
+				HI_OPCODE_CASE(RetVar_ret_28):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy28(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_32:
+				HI_OPCODE_CASE(RetVar_ret_32):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    Copy32(frame->ret, (void*)(localVarBase + __ret));
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_n:
+				HI_OPCODE_CASE(RetVar_ret_n):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 				    std::memcpy(frame->ret, (void*)(localVarBase + __ret), __size);
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_void:
+				HI_OPCODE_CASE(RetVar_void):
 				{
 				    LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNative_void:
+				HI_OPCODE_CASE(CallNative_void):
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 6);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 10);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, nullptr);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNative_ret:
+				HI_OPCODE_CASE(CallNative_ret):
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 6);
@@ -4909,57 +6054,59 @@ else \
 					uint16_t __ret = *(uint16_t*)(ip + 14);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, (void*)(localVarBase + __ret));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterp_void:
+				HI_OPCODE_CASE(CallInterp_void):
 				{
 					MethodInfo* __methodInfo = *(MethodInfo**)(ip + 2);
 					uint16_t __argBase = *(uint16_t*)(ip + 10);
 				    CALL_INTERP((ip + 12), __methodInfo, (StackObject*)(void*)(localVarBase + __argBase), nullptr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterp_ret:
+				HI_OPCODE_CASE(CallInterp_ret):
 				{
 					MethodInfo* __methodInfo = *(MethodInfo**)(ip + 2);
 					uint16_t __argBase = *(uint16_t*)(ip + 10);
 					uint16_t __ret = *(uint16_t*)(ip + 12);
 				    CALL_INTERP((ip + 14), __methodInfo, (StackObject*)(void*)(localVarBase + __argBase), (void*)(localVarBase + __ret));
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallVirtual_void:
+				HI_OPCODE_CASE(CallVirtual_void):
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 6);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 10);
+					uint32_t __inlineCache = *(uint32_t*)(ip + 14);
 				    uint16_t* _argIdxData = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
 					StackObject* _objPtr = localVarBase + _argIdxData[0];
 				    Il2CppObject* _obj = _objPtr->obj;
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]));
+				    MethodInfo* _actualMethod = GetObjectVirtualMethodWithInlineCache(_obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]), ((VirtualCallInlineCache*)&imi->resolveDatas[__inlineCache]));
 				    if (huatuo::metadata::IsInterpreterMethod(_actualMethod))
 				    {
 						if (_actualMethod->klass->valuetype)
 						{
 				            _objPtr->obj += 1;
 						}
-				        CALL_INTERP((ip + 14), _actualMethod, _objPtr, nullptr);
+				        CALL_INTERP((ip + 18), _actualMethod, _objPtr, nullptr);
 				    }
 				    else 
 				    {
 				        ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_actualMethod, _argIdxData, localVarBase, nullptr);
-				        ip += 14;
+				        ip += 18;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallVirtual_ret:
+				HI_OPCODE_CASE(CallVirtual_ret):
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 6);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 10);
 					uint16_t __ret = *(uint16_t*)(ip + 14);
+					uint32_t __inlineCache = *(uint32_t*)(ip + 16);
 				    uint16_t* _argIdxData = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
 					StackObject* _objPtr = localVarBase + _argIdxData[0];
 				    Il2CppObject* _obj = _objPtr->obj;
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]));
+				    MethodInfo* _actualMethod = GetObjectVirtualMethodWithInlineCache(_obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]), ((VirtualCallInlineCache*)&imi->resolveDatas[__inlineCache]));
 				    void* ret = (void*)(localVarBase + __ret);
 				    if (huatuo::metadata::IsInterpreterMethod(_actualMethod))
 				    {
@@ -4967,52 +6114,54 @@ else \
 						{
 				            _objPtr->obj += 1;
 						}
-				        CALL_INTERP((ip + 16), _actualMethod, _objPtr, ret);
+				        CALL_INTERP((ip + 20), _actualMethod, _objPtr, ret);
 				    }
 				    else 
 				    {
 				        ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_actualMethod, _argIdxData, localVarBase, ret);
-				        ip += 16;
+				        ip += 20;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterpVirtual_void:
+				HI_OPCODE_CASE(CallInterpVirtual_void):
 				{
 					MethodInfo* __method = *(MethodInfo**)(ip + 2);
 					uint16_t __argBase = *(uint16_t*)(ip + 10);
+					uint32_t __inlineCache = *(uint32_t*)(ip + 12);
 				    StackObject* _argBasePtr = (StackObject*)(void*)(localVarBase + __argBase);
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_argBasePtr->obj, __method);
+				    MethodInfo* _actualMethod = GetObjectVirtualMethodWithInlineCache(_argBasePtr->obj, __method, ((VirtualCallInlineCache*)&imi->resolveDatas[__inlineCache]));
 				    if (_actualMethod->klass->valuetype)
 				    {
 				        _argBasePtr->obj += 1; // adjust pointer
 				    }
-				    CALL_INTERP((ip + 12), _actualMethod, _argBasePtr, nullptr);
-				    continue;
+				    CALL_INTERP((ip + 16), _actualMethod, _argBasePtr, nullptr);
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterpVirtual_ret:
+				HI_OPCODE_CASE(CallInterpVirtual_ret):
 				{
 					MethodInfo* __method = *(MethodInfo**)(ip + 2);
 					uint16_t __argBase = *(uint16_t*)(ip + 10);
 					uint16_t __ret = *(uint16_t*)(ip + 12);
+					uint32_t __inlineCache = *(uint32_t*)(ip + 14);
 				    StackObject* _argBasePtr = (StackObject*)(void*)(localVarBase + __argBase);
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_argBasePtr->obj, __method);
+				    MethodInfo* _actualMethod = GetObjectVirtualMethodWithInlineCache(_argBasePtr->obj, __method, ((VirtualCallInlineCache*)&imi->resolveDatas[__inlineCache]));
 				    if (_actualMethod->klass->valuetype)
 				    {
 				        _argBasePtr->obj += 1; // adjust pointer
 				    }
-				    CALL_INTERP((ip + 14), _actualMethod, _argBasePtr, (void*)(localVarBase + __ret));
-				    continue;
+				    CALL_INTERP((ip + 18), _actualMethod, _argBasePtr, (void*)(localVarBase + __ret));
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInd_void:
+				HI_OPCODE_CASE(CallInd_void):
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 6);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 10);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, nullptr);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInd_ret:
+				HI_OPCODE_CASE(CallInd_ret):
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 6);
@@ -5020,32 +6169,28 @@ else \
 					uint16_t __ret = *(uint16_t*)(ip + 14);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, (void*)(localVarBase + __argIdxs));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegate_void:
+				HI_OPCODE_CASE(CallDelegate_void):
 				{
 					uint32_t __managed2NativeStaticMethod = *(uint32_t*)(ip + 2);
 					uint32_t __managed2NativeInstanceMethod = *(uint32_t*)(ip + 6);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 10);
+					uint16_t __invokeState = *(uint16_t*)(ip + 14);
 				    uint16_t* resolvedArgIdxs = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
-				    Il2CppObject* __obj = localVarBase[resolvedArgIdxs[0]].obj;
-				    HiCallDelegate((Il2CppMulticastDelegate*)__obj, ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeStaticMethod]), ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeInstanceMethod]), resolvedArgIdxs, localVarBase, nullptr);
-				    ip += 14;
-				    continue;
+				    CALL_DELEGATE(16, resolvedArgIdxs, __invokeState, ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeStaticMethod]), ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeInstanceMethod]), nullptr);
 				}
-				case HiOpcodeEnum::CallDelegate_ret:
+				HI_OPCODE_CASE(CallDelegate_ret):
 				{
 					uint32_t __managed2NativeStaticMethod = *(uint32_t*)(ip + 2);
 					uint32_t __managed2NativeInstanceMethod = *(uint32_t*)(ip + 6);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 10);
 					uint16_t __ret = *(uint16_t*)(ip + 14);
+					uint16_t __invokeState = *(uint16_t*)(ip + 16);
 				    uint16_t* resolvedArgIdxs = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
-				    Il2CppObject* __obj = localVarBase[resolvedArgIdxs[0]].obj;
-				    HiCallDelegate((Il2CppMulticastDelegate*)__obj, ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeStaticMethod]), ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeInstanceMethod]), resolvedArgIdxs, localVarBase, (void*)(localVarBase + __ret));
-				    ip += 16;
-				    continue;
+				    CALL_DELEGATE(18, resolvedArgIdxs, __invokeState, ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeStaticMethod]), ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeInstanceMethod]), (void*)(localVarBase + __ret));
 				}
-				case HiOpcodeEnum::NewDelegate:
+				HI_OPCODE_CASE(NewDelegate):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
@@ -5055,7 +6200,15 @@ else \
 				    il2cpp::vm::Type::ConstructDelegate(del, (*(Il2CppObject**)(localVarBase + __obj)), (*(MethodInfo**)(localVarBase + __method))->methodPointer, (*(MethodInfo**)(localVarBase + __method)));
 				    (*(Il2CppObject**)(localVarBase + __dst)) = (Il2CppObject*)del;
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdftnVar):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					MethodInfo* __method = *(MethodInfo**)(ip + 4);
+				    (*(MethodInfo**)(localVarBase + __dst)) = __method;
+				    ip += 12;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}FUNCTION
@@ -5063,779 +6216,779 @@ else \
 
 #pragma region OBJECT
 		//!!!{{OBJECT
-				case HiOpcodeEnum::BoxVarVar:
+				HI_OPCODE_CASE(BoxVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __data = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
 				    (*(Il2CppObject**)(localVarBase + __dst)) = il2cpp::vm::Object::Box(__klass, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnBoxVarVar:
+				HI_OPCODE_CASE(UnBoxVarVar):
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
 				    (*(void**)(localVarBase + __addr)) = HiUnbox((*(Il2CppObject**)(localVarBase + __obj)), __klass);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnBoxAnyVarVar:
+				HI_OPCODE_CASE(UnBoxAnyVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
 				    HiUnboxAny((*(Il2CppObject**)(localVarBase + __obj)), __klass, (void*)(localVarBase + __dst));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CastclassVar:
+				HI_OPCODE_CASE(CastclassVar):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint32_t __klass = *(uint32_t*)(ip + 4);
 				    HiCastClass((*(Il2CppObject**)(localVarBase + __obj)), ((Il2CppClass*)imi->resolveDatas[__klass]));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::IsInstVar:
+				HI_OPCODE_CASE(IsInstVar):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint32_t __klass = *(uint32_t*)(ip + 4);
 				    (*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::IsInst((*(Il2CppObject**)(localVarBase + __obj)), ((Il2CppClass*)imi->resolveDatas[__klass]));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdtokenVar:
+				HI_OPCODE_CASE(LdtokenVar):
 				{
 					uint16_t __runtimeHandle = *(uint16_t*)(ip + 2);
 					void* __token = *(void**)(ip + 4);
 				    (*(void**)(localVarBase + __runtimeHandle)) = __token;
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::MakeRefVarVar:
+				HI_OPCODE_CASE(MakeRefVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __data = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
 				    (*(Il2CppTypedRef*)(localVarBase + __dst)) = MAKE_TYPEDREFERENCE(__klass, (*(void**)(localVarBase + __data)));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RefAnyTypeVarVar:
+				HI_OPCODE_CASE(RefAnyTypeVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __typedRef = *(uint16_t*)(ip + 4);
 				    (*(void**)(localVarBase + __dst)) = RefAnyType((*(Il2CppTypedRef*)(localVarBase + __typedRef)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RefAnyValueVarVar:
+				HI_OPCODE_CASE(RefAnyValueVarVar):
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __typedRef = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
 				    (*(void**)(localVarBase + __addr)) = RefAnyValue((*(Il2CppTypedRef*)(localVarBase + __typedRef)), __klass);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_1:
+				HI_OPCODE_CASE(CpobjVarVar_1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy1((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_2:
+				HI_OPCODE_CASE(CpobjVarVar_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy2((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_4:
+				HI_OPCODE_CASE(CpobjVarVar_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy4((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_8:
+				HI_OPCODE_CASE(CpobjVarVar_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy8((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_12:
+				HI_OPCODE_CASE(CpobjVarVar_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy12((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_16:
+				HI_OPCODE_CASE(CpobjVarVar_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy16((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_20:
+				HI_OPCODE_CASE(CpobjVarVar_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy20((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_24:
+				HI_OPCODE_CASE(CpobjVarVar_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy24((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_28:
+				HI_OPCODE_CASE(CpobjVarVar_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy28((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_32:
+				HI_OPCODE_CASE(CpobjVarVar_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy32((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_n_2:
+				HI_OPCODE_CASE(CpobjVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)), (*(uint16_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_n_4:
+				HI_OPCODE_CASE(CpobjVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_1:
+				HI_OPCODE_CASE(LdobjVarVar_1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy1((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_2:
+				HI_OPCODE_CASE(LdobjVarVar_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy2((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_4:
+				HI_OPCODE_CASE(LdobjVarVar_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy4((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_8:
+				HI_OPCODE_CASE(LdobjVarVar_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy8((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_12:
+				HI_OPCODE_CASE(LdobjVarVar_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy12((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_16:
+				HI_OPCODE_CASE(LdobjVarVar_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy16((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_20:
+				HI_OPCODE_CASE(LdobjVarVar_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy20((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_24:
+				HI_OPCODE_CASE(LdobjVarVar_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy24((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_28:
+				HI_OPCODE_CASE(LdobjVarVar_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy28((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_32:
+				HI_OPCODE_CASE(LdobjVarVar_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy32((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_n_2:
+				HI_OPCODE_CASE(LdobjVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)), (*(uint16_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_n_4:
+				HI_OPCODE_CASE(LdobjVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_1:
+				HI_OPCODE_CASE(StobjVarVar_1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy1((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_2:
+				HI_OPCODE_CASE(StobjVarVar_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy2((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_4:
+				HI_OPCODE_CASE(StobjVarVar_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy4((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_8:
+				HI_OPCODE_CASE(StobjVarVar_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy8((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_12:
+				HI_OPCODE_CASE(StobjVarVar_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy12((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_16:
+				HI_OPCODE_CASE(StobjVarVar_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy16((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_20:
+				HI_OPCODE_CASE(StobjVarVar_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy20((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_24:
+				HI_OPCODE_CASE(StobjVarVar_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy24((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_28:
+				HI_OPCODE_CASE(StobjVarVar_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy28((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_32:
+				HI_OPCODE_CASE(StobjVarVar_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy32((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_n_2:
+				HI_OPCODE_CASE(StobjVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src), (*(uint16_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_n_4:
+				HI_OPCODE_CASE(StobjVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memcpy((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_1:
+				HI_OPCODE_CASE(InitobjVar_1):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault1((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_2:
+				HI_OPCODE_CASE(InitobjVar_2):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault2((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_4:
+				HI_OPCODE_CASE(InitobjVar_4):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault4((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_8:
+				HI_OPCODE_CASE(InitobjVar_8):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault8((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_12:
+				HI_OPCODE_CASE(InitobjVar_12):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault12((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_16:
+				HI_OPCODE_CASE(InitobjVar_16):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault16((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_20:
+				HI_OPCODE_CASE(InitobjVar_20):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault20((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_24:
+				HI_OPCODE_CASE(InitobjVar_24):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault24((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_28:
+				HI_OPCODE_CASE(InitobjVar_28):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault28((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_32:
+				HI_OPCODE_CASE(InitobjVar_32):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault32((*(void**)(localVarBase + __obj)));
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_n_2:
+				HI_OPCODE_CASE(InitobjVar_n_2):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 					InitDefaultN((*(void**)(localVarBase + __obj)), __size);
 				    ip += 6;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_n_4:
+				HI_OPCODE_CASE(InitobjVar_n_4):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint32_t __size = *(uint32_t*)(ip + 4);
 					InitDefaultN((*(void**)(localVarBase + __obj)), __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdstrVar:
+				HI_OPCODE_CASE(LdstrVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint32_t __str = *(uint32_t*)(ip + 4);
 				    (*(Il2CppString**)(localVarBase + __dst)) = ((Il2CppString*)imi->resolveDatas[__str]);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i1:
+				HI_OPCODE_CASE(LdfldVarVar_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u1:
+				HI_OPCODE_CASE(LdfldVarVar_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i2:
+				HI_OPCODE_CASE(LdfldVarVar_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u2:
+				HI_OPCODE_CASE(LdfldVarVar_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i4:
+				HI_OPCODE_CASE(LdfldVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u4:
+				HI_OPCODE_CASE(LdfldVarVar_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i8:
+				HI_OPCODE_CASE(LdfldVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u8:
+				HI_OPCODE_CASE(LdfldVarVar_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_8:
+				HI_OPCODE_CASE(LdfldVarVar_size_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy8((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_12:
+				HI_OPCODE_CASE(LdfldVarVar_size_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy12((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_16:
+				HI_OPCODE_CASE(LdfldVarVar_size_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy16((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_20:
+				HI_OPCODE_CASE(LdfldVarVar_size_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy20((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_24:
+				HI_OPCODE_CASE(LdfldVarVar_size_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy24((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_28:
+				HI_OPCODE_CASE(LdfldVarVar_size_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy28((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_32:
+				HI_OPCODE_CASE(LdfldVarVar_size_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy32((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_n_2:
+				HI_OPCODE_CASE(LdfldVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					uint16_t __size = *(uint16_t*)(ip + 8);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memcpy((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, __size);
 				    ip += 10;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_n_4:
+				HI_OPCODE_CASE(LdfldVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					uint32_t __size = *(uint32_t*)(ip + 8);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memcpy((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, __size);
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i1:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(int8_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u1:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i2:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(int16_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u2:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i4:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u4:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i8:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __dst)) = *(int64_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u8:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_8:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy8((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_12:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy12((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_16:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy16((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_20:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy20((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_24:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy24((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_28:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy28((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_32:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy32((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_n_2:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -5843,9 +6996,9 @@ else \
 					uint16_t __size = *(uint16_t*)(ip + 8);
 					std::memcpy((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset, __size);
 				    ip += 10;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_n_4:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -5853,1744 +7006,2924 @@ else \
 					uint32_t __size = *(uint32_t*)(ip + 8);
 					std::memcpy((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset, __size);
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldaVarVar:
+				HI_OPCODE_CASE(LdfldaVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(void**)(localVarBase + __dst)) = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i1:
+				HI_OPCODE_CASE(StfldVarVar_i1):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(int8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(int8_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u1:
+				HI_OPCODE_CASE(StfldVarVar_u1):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(uint8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(uint8_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i2:
+				HI_OPCODE_CASE(StfldVarVar_i2):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(int16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(int16_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u2:
+				HI_OPCODE_CASE(StfldVarVar_u2):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(uint16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(uint16_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i4:
+				HI_OPCODE_CASE(StfldVarVar_i4):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(int32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(int32_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u4:
+				HI_OPCODE_CASE(StfldVarVar_u4):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(uint32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(uint32_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i8:
+				HI_OPCODE_CASE(StfldVarVar_i8):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(int64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(int64_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u8:
+				HI_OPCODE_CASE(StfldVarVar_u8):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    *(uint64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset) = (*(uint64_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_8:
+				HI_OPCODE_CASE(StfldVarVar_size_8):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy8((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_12:
+				HI_OPCODE_CASE(StfldVarVar_size_12):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy12((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_16:
+				HI_OPCODE_CASE(StfldVarVar_size_16):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy16((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_20:
+				HI_OPCODE_CASE(StfldVarVar_size_20):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy20((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_24:
+				HI_OPCODE_CASE(StfldVarVar_size_24):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy24((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_28:
+				HI_OPCODE_CASE(StfldVarVar_size_28):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy28((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_32:
+				HI_OPCODE_CASE(StfldVarVar_size_32):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy32((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_n_2:
+				HI_OPCODE_CASE(StfldVarVar_n_2):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
 					uint16_t __size = *(uint16_t*)(ip + 8);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memcpy((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 10;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_n_4:
+				HI_OPCODE_CASE(StfldVarVar_n_4):
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 6);
 					uint32_t __size = *(uint32_t*)(ip + 8);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    CHECK_NOT_NULL_EX((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memcpy((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i1:
+				HI_OPCODE_CASE(LdsfldVarVar_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_i1);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u1:
+				HI_OPCODE_CASE(LdsfldVarVar_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_u1);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i2:
+				HI_OPCODE_CASE(LdsfldVarVar_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_i2);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u2:
+				HI_OPCODE_CASE(LdsfldVarVar_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_u2);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i4:
+				HI_OPCODE_CASE(LdsfldVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_i4);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u4:
+				HI_OPCODE_CASE(LdsfldVarVar_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_u4);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i8:
+				HI_OPCODE_CASE(LdsfldVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_i8);
 				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u8:
+				HI_OPCODE_CASE(LdsfldVarVar_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_u8);
 				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_8:
+				HI_OPCODE_CASE(LdsfldVarVar_size_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_8);
 				    Copy8((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_12:
+				HI_OPCODE_CASE(LdsfldVarVar_size_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_12);
 				    Copy12((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_16:
+				HI_OPCODE_CASE(LdsfldVarVar_size_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_16);
 				    Copy16((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_20:
+				HI_OPCODE_CASE(LdsfldVarVar_size_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_20);
 				    Copy20((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_24:
+				HI_OPCODE_CASE(LdsfldVarVar_size_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_24);
 				    Copy24((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_28:
+				HI_OPCODE_CASE(LdsfldVarVar_size_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_28);
 				    Copy28((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_32:
+				HI_OPCODE_CASE(LdsfldVarVar_size_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_size_32);
 				    Copy32((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_n_2:
+				HI_OPCODE_CASE(LdsfldVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 					uint16_t __size = *(uint16_t*)(ip + 14);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_n_2);
 				    std::memcpy((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_n_4:
+				HI_OPCODE_CASE(LdsfldVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 					uint32_t __size = *(uint32_t*)(ip + 14);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldInitedVarVar_n_4);
 				    std::memcpy((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
 				    ip += 18;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i1:
+				HI_OPCODE_CASE(StsfldVarVar_i1):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_i1);
 				    *(int8_t*)(((byte*)__klass->static_fields) + __offset) = (*(int8_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u1:
+				HI_OPCODE_CASE(StsfldVarVar_u1):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_u1);
 				    *(uint8_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint8_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i2:
+				HI_OPCODE_CASE(StsfldVarVar_i2):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_i2);
 				    *(int16_t*)(((byte*)__klass->static_fields) + __offset) = (*(int16_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u2:
+				HI_OPCODE_CASE(StsfldVarVar_u2):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_u2);
 				    *(uint16_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint16_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i4:
+				HI_OPCODE_CASE(StsfldVarVar_i4):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_i4);
 				    *(int32_t*)(((byte*)__klass->static_fields) + __offset) = (*(int32_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u4:
+				HI_OPCODE_CASE(StsfldVarVar_u4):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_u4);
 				    *(uint32_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint32_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i8:
+				HI_OPCODE_CASE(StsfldVarVar_i8):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_i8);
 				    *(int64_t*)(((byte*)__klass->static_fields) + __offset) = (*(int64_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u8:
+				HI_OPCODE_CASE(StsfldVarVar_u8):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_u8);
 				    *(uint64_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint64_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_8:
+				HI_OPCODE_CASE(StsfldVarVar_size_8):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_8);
 				    Copy8(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_12:
+				HI_OPCODE_CASE(StsfldVarVar_size_12):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_12);
 				    Copy12(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_16:
+				HI_OPCODE_CASE(StsfldVarVar_size_16):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_16);
 				    Copy16(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_20:
+				HI_OPCODE_CASE(StsfldVarVar_size_20):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_20);
 				    Copy20(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_24:
+				HI_OPCODE_CASE(StsfldVarVar_size_24):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_24);
 				    Copy24(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_28:
+				HI_OPCODE_CASE(StsfldVarVar_size_28):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_28);
 				    Copy28(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_32:
+				HI_OPCODE_CASE(StsfldVarVar_size_32):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_size_32);
 				    Copy32(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_n_2:
+				HI_OPCODE_CASE(StsfldVarVar_n_2):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 					uint16_t __size = *(uint16_t*)(ip + 14);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_n_2);
 				    std::memcpy(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_n_4:
+				HI_OPCODE_CASE(StsfldVarVar_n_4):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 					uint32_t __size = *(uint32_t*)(ip + 14);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StsfldInitedVarVar_n_4);
 				    std::memcpy(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 18;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldaVarVar:
+				HI_OPCODE_CASE(LdsfldaVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdsfldaInitedVarVar);
 				    (*(void**)(localVarBase + __dst)) = ((byte*)__klass->static_fields) + __offset;
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalaVarVar:
+				HI_OPCODE_CASE(LdthreadlocalaVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalaInitedVarVar);
 				    (*(void**)(localVarBase + __dst)) = il2cpp::vm::Thread::GetThreadStaticData(__offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i1:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_i1);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u1:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_u1);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i2:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_i2);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u2:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_u2);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i4:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_i4);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u4:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_u4);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i8:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_i8);
 				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u8:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_u8);
 				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_8:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_8);
 				    Copy8((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_12:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_12):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_12);
 				    Copy12((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_16:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_16):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_16);
 				    Copy16((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_20:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_20):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_20);
 				    Copy20((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_24:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_24):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_24);
 				    Copy24((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_28:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_28):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_28);
 				    Copy28((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_32:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_32):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_size_32);
 				    Copy32((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_n_2:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_n_2):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 					uint16_t __size = *(uint16_t*)(ip + 16);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_n_2);
 				    std::memcpy((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset), __size);
 				    ip += 18;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_n_4:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_n_4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
 					int32_t __offset = *(int32_t*)(ip + 12);
 					uint32_t __size = *(uint32_t*)(ip + 16);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, LdthreadlocalInitedVarVar_n_4);
 				    std::memcpy((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset), __size);
 				    ip += 20;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i1:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i1):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_i1);
 				    *(int8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int8_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u1:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u1):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_u1);
 				    *(uint8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint8_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i2):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_i2);
 				    *(int16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int16_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u2):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_u2);
 				    *(uint16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint16_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i4):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_i4);
 				    *(int32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int32_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u4):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_u4);
 				    *(uint32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint32_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i8:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i8):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_i8);
 				    *(int64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int64_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u8:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u8):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_u8);
 				    *(uint64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint64_t*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_8:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_8):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_8);
 				    Copy8(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_12:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_12):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_12);
 				    Copy12(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_16:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_16):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_16);
 				    Copy16(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_20:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_20):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_20);
 				    Copy20(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_24:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_24):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_24);
 				    Copy24(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_28:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_28):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_28);
 				    Copy28(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_32:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_32):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_size_32);
 				    Copy32(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_n_2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_n_2):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 					uint16_t __size = *(uint16_t*)(ip + 14);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_n_2);
 				    std::memcpy(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_n_4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_n_4):
 				{
 					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 10);
 					uint16_t __data = *(uint16_t*)(ip + 12);
 					uint32_t __size = *(uint32_t*)(ip + 14);
 				    Interpreter::RuntimeClassCCtorInit(__klass);
+				    PATCH_CCTOR_FREE_OPCODE(__klass, StthreadlocalInitedVarVar_n_4);
 				    std::memcpy(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data), __size);
 				    ip += 18;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-
-				//!!!}}OBJECT
-#pragma endregion
-
-#pragma region ARRAY
-		//!!!{{ARRAY
-				case HiOpcodeEnum::NewArrVarVar_4:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i1):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __size = *(uint16_t*)(ip + 4);
-					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
-				    (*(Il2CppArray**)(localVarBase + __arr)) =  il2cpp::vm::Array::NewSpecific(__klass, (*(int32_t*)(localVarBase + __size)));
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewArrVarVar_8:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u1):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __size = *(uint16_t*)(ip + 4);
-					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
-				    (*(Il2CppArray**)(localVarBase + __arr)) =  il2cpp::vm::Array::NewSpecific(__klass, (*(int64_t*)(localVarBase + __size)));
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 14;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayLengthVarVar_4:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i2):
 				{
-					uint16_t __len = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    (*(uint32_t*)(localVarBase + __len)) = (uint32_t)il2cpp::vm::Array::GetLength((*(Il2CppArray**)(localVarBase + __arr)));
-				    ip += 6;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayLengthVarVar_8:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u2):
 				{
-					uint16_t __len = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    (*(uint64_t*)(localVarBase + __len)) = (uint64_t)il2cpp::vm::Array::GetLength((*(Il2CppArray**)(localVarBase + __arr)));
-				    ip += 6;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementAddressAddrVarVar_i4:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i4):
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy8((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_12):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy12((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_16):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy16((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_20):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy20((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_24):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy24((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_28):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy28((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_32):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    Copy32((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_n_2):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+					uint16_t __size = *(uint16_t*)(ip + 14);
+				    std::memcpy((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldInitedVarVar_n_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+					uint32_t __size = *(uint32_t*)(ip + 14);
+				    std::memcpy((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
+				    ip += 18;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i1):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int8_t*)(((byte*)__klass->static_fields) + __offset) = (*(int8_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u1):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint8_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint8_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i2):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int16_t*)(((byte*)__klass->static_fields) + __offset) = (*(int16_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u2):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint16_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint16_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i4):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int32_t*)(((byte*)__klass->static_fields) + __offset) = (*(int32_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u4):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint32_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint32_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i8):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int64_t*)(((byte*)__klass->static_fields) + __offset) = (*(int64_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u8):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint64_t*)(((byte*)__klass->static_fields) + __offset) = (*(uint64_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_8):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy8(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_12):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy12(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_16):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy16(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_20):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy20(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_24):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy24(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_28):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy28(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_32):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy32(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_n_2):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+					uint16_t __size = *(uint16_t*)(ip + 14);
+				    std::memcpy(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_n_4):
+				{
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+					uint32_t __size = *(uint32_t*)(ip + 14);
+				    std::memcpy(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
+				    ip += 18;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldaInitedVarVar):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 12);
+				    (*(void**)(localVarBase + __dst)) = ((byte*)__klass->static_fields) + __offset;
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalaInitedVarVar):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(void**)(localVarBase + __dst)) = il2cpp::vm::Thread::GetThreadStaticData(__offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_i1):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_u1):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_i2):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_u2):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_i4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_u4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_i8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_u8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy8((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_12):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy12((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_16):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy16((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_20):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy20((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_24):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy24((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_28):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy28((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_size_32):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+				    Copy32((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_n_2):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+					uint16_t __size = *(uint16_t*)(ip + 16);
+				    std::memcpy((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset), __size);
+				    ip += 18;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdthreadlocalInitedVarVar_n_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 12);
+					uint32_t __size = *(uint32_t*)(ip + 16);
+				    std::memcpy((void*)(localVarBase + __dst), il2cpp::vm::Thread::GetThreadStaticData(__offset), __size);
+				    ip += 20;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_i1):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int8_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_u1):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint8_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint8_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_i2):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int16_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_u2):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint16_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint16_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_i4):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int32_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_u4):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint32_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint32_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_i8):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(int64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(int64_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_u8):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    *(uint64_t*)(il2cpp::vm::Thread::GetThreadStaticData(__offset)) = (*(uint64_t*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_8):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy8(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_12):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy12(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_16):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy16(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_20):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy20(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_24):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy24(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_28):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy28(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_size_32):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+				    Copy32(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_n_2):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+					uint16_t __size = *(uint16_t*)(ip + 14);
+				    std::memcpy(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StthreadlocalInitedVarVar_n_4):
+				{
+					uint16_t __offset = *(uint16_t*)(ip + 10);
+					uint16_t __data = *(uint16_t*)(ip + 12);
+					uint32_t __size = *(uint32_t*)(ip + 14);
+				    std::memcpy(il2cpp::vm::Thread::GetThreadStaticData(__offset), (void*)(localVarBase + __data), __size);
+				    ip += 18;
+				    HI_DISPATCH_NEXT();
+				}
+
+				//!!!}}OBJECT
+#pragma endregion
+
+#pragma region ARRAY
+		//!!!{{ARRAY
+				HI_OPCODE_CASE(NewArrVarVar_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
+				    (*(Il2CppArray**)(localVarBase + __arr)) =  il2cpp::vm::Array::NewSpecific(__klass, (*(int32_t*)(localVarBase + __size)));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(NewArrVarVar_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
+				    (*(Il2CppArray**)(localVarBase + __arr)) =  il2cpp::vm::Array::NewSpecific(__klass, (*(int64_t*)(localVarBase + __size)));
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayLengthVarVar_4):
+				{
+					uint16_t __len = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    (*(uint32_t*)(localVarBase + __len)) = (uint32_t)il2cpp::vm::Array::GetLength((*(Il2CppArray**)(localVarBase + __arr)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayLengthVarVar_8):
+				{
+					uint16_t __len = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    (*(uint64_t*)(localVarBase + __len)) = (uint64_t)il2cpp::vm::Array::GetLength((*(Il2CppArray**)(localVarBase + __arr)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementAddressAddrVarVar_i4):
+				{
+					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementAddressAddrVarVar_i8):
+				{
+					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementAddressCheckAddrVarVar_i4):
+				{
+					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+					Il2CppClass* __eleKlass = *(Il2CppClass**)(ip + 8);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    CHECK_ARRAY_ELEMENT_TYPE_MATCH(arr->klass, __eleKlass);
+				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementAddressCheckAddrVarVar_i8):
+				{
+					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+					Il2CppClass* __eleKlass = *(Il2CppClass**)(ip + 8);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    CHECK_ARRAY_ELEMENT_TYPE_MATCH(arr->klass, __eleKlass);
+				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i1_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int8_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u1_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint8_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i2_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int16_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u2_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint16_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i4_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u4_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint32_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i8_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int64_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u8_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint64_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_12_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    Copy12((void*)(localVarBase + __dst), load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), 12));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_16_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    Copy16((void*)(localVarBase + __dst), load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), 16));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_n_4):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
+				    std::memcpy((void*)(localVarBase + __dst), load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), eleSize), eleSize);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i1_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int8_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u1_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint8_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i2_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int16_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u2_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint16_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i4_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u4_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint32_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i8_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int64_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u8_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint64_t, (*(int64_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_12_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    Copy12((void*)(localVarBase + __dst), load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), 12));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_16_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    Copy16((void*)(localVarBase + __dst), load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), 16));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_n_8):
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
+				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
+				    std::memcpy((void*)(localVarBase + __dst), load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), eleSize), eleSize);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i1_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int8_t, (*(int32_t*)(localVarBase + __index)), (*(int8_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u1_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint8_t, (*(int32_t*)(localVarBase + __index)), (*(uint8_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i2_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int16_t, (*(int32_t*)(localVarBase + __index)), (*(int16_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u2_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint16_t, (*(int32_t*)(localVarBase + __index)), (*(uint16_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i4_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int32_t, (*(int32_t*)(localVarBase + __index)), (*(int32_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u4_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint32_t, (*(int32_t*)(localVarBase + __index)), (*(uint32_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i8_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int64_t, (*(int32_t*)(localVarBase + __index)), (*(int64_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u8_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint64_t, (*(int32_t*)(localVarBase + __index)), (*(uint64_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_ref_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_setref((*(Il2CppArray**)(localVarBase + __arr)), (*(int32_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_size_12_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
+				    Copy12(load_array_elema(_arr, (*(int32_t*)(localVarBase + __index)), 12), (void*)(localVarBase + __ele));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_size_16_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
+				    Copy16(load_array_elema(_arr, (*(int32_t*)(localVarBase + __index)), 16), (void*)(localVarBase + __ele));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_n_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_EX(arr);
+				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
+				    il2cpp_array_setrefwithsize(arr, eleSize, __index, (void*)(localVarBase + __ele));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i1_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int8_t, (*(int64_t*)(localVarBase + __index)), (*(int8_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u1_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint8_t, (*(int64_t*)(localVarBase + __index)), (*(uint8_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i2_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int16_t, (*(int64_t*)(localVarBase + __index)), (*(int16_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u2_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint16_t, (*(int64_t*)(localVarBase + __index)), (*(uint16_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementAddressAddrVarVar_i8:
+				HI_OPCODE_CASE(SetArrayElementVarVar_i4_8):
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int32_t, (*(int64_t*)(localVarBase + __index)), (*(int32_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementAddressCheckAddrVarVar_i4:
+				HI_OPCODE_CASE(SetArrayElementVarVar_u4_8):
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-					Il2CppClass* __eleKlass = *(Il2CppClass**)(ip + 8);
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint32_t, (*(int64_t*)(localVarBase + __index)), (*(uint32_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i8_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int64_t, (*(int64_t*)(localVarBase + __index)), (*(int64_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u8_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint64_t, (*(int64_t*)(localVarBase + __index)), (*(uint64_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_ref_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    il2cpp_array_setref((*(Il2CppArray**)(localVarBase + __arr)), (*(int64_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_size_12_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
+				    Copy12(load_array_elema(_arr, (*(int64_t*)(localVarBase + __index)), 12), (void*)(localVarBase + __ele));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_size_16_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
+				    Copy16(load_array_elema(_arr, (*(int64_t*)(localVarBase + __index)), 16), (void*)(localVarBase + __ele));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_n_8):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    CheckArrayElementTypeCompatible(arr->klass, __eleKlass);
-				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    CHECK_NOT_NULL_EX(arr);
+				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
+				    il2cpp_array_setrefwithsize(arr, eleSize, __index, (void*)(localVarBase + __ele));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementObjectCheckVarVar_4):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 8);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    CHECK_ARRAY_TYPE_COMPATIBLE((*(Il2CppArray**)(localVarBase + __arr)), __klass);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), Il2CppObject*, (*(int32_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementAddressCheckAddrVarVar_i8:
+				HI_OPCODE_CASE(SetArrayElementObjectCheckVarVar_8):
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-					Il2CppClass* __eleKlass = *(Il2CppClass**)(ip + 8);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    CheckArrayElementTypeCompatible(arr->klass, __eleKlass);
-				    (*(void**)(localVarBase + __addr)) = load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 8);
+				    CHECK_NOT_NULL_EX((*(Il2CppArray**)(localVarBase + __arr)));
+				    CHECK_ARRAY_TYPE_COMPATIBLE((*(Il2CppArray**)(localVarBase + __arr)), __klass);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), Il2CppObject*, (*(int64_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i1_4:
+				HI_OPCODE_CASE(NewMdArrVarVar_length):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int8_t, (*(int32_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
+				(*(Il2CppArray**)(localVarBase + __arr)) =  NewMdArray(__klass, (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), nullptr);
+				    ip += 14;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u1_4:
+				HI_OPCODE_CASE(NewMdArrVarVar_length_bound):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint8_t, (*(int32_t*)(localVarBase + __index)));
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
+					uint16_t __lowerBoundIdxs = *(uint16_t*)(ip + 6);
+					Il2CppClass* __klass = *(Il2CppClass**)(ip + 8);
+				(*(Il2CppArray**)(localVarBase + __arr)) =  NewMdArray(__klass, (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), (il2cpp_array_size_t*)(void*)(localVarBase + __lowerBoundIdxs));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetMdArrElementVarVar):
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+				    GetMdArrayElement((*(Il2CppArray**)(localVarBase + __arr)), (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i2_4:
+				HI_OPCODE_CASE(GetMdArrElementAddressVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int16_t, (*(int32_t*)(localVarBase + __index)));
+					uint16_t __lengthIdxs = *(uint16_t*)(ip + 6);
+				    (*(void**)(localVarBase + __addr)) = GetMdArrayElementAddress((*(Il2CppArray**)(localVarBase + __arr)), (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u2_4:
+				HI_OPCODE_CASE(SetMdArrElementVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint16_t, (*(int32_t*)(localVarBase + __index)));
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+				    SetMdArrayElement((*(Il2CppArray**)(localVarBase + __arr)), (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+
+				//!!!}}ARRAY
+#pragma endregion
+
+#pragma region EXCEPTION
+		//!!!{{EXCEPTION
+				HI_OPCODE_CASE(ThrowEx):
+				{
+					uint16_t __exceptionObj = *(uint16_t*)(ip + 2);
+					THROW_EX((Il2CppException*)(*(Il2CppObject**)(localVarBase + __exceptionObj)));
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(RethrowEx):
+				{
+					RETHROW_EX();
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LeaveEx):
+				{
+					int32_t __offset = *(int32_t*)(ip + 2);
+					int32_t __finallyIndex = *(int32_t*)(ip + 6);
+					LEAVE_EX(__offset, __finallyIndex);
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(EndFilterEx):
+				{
+					uint16_t __value = *(uint16_t*)(ip + 2);
+					ENDFILTER_EX((*(bool*)(localVarBase + __value)));
+				    ip += 4;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(EndFinallyEx):
+				{
+					ENDFINALLY_EX();
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i4_4:
+
+				//!!!}}EXCEPTION
+#pragma endregion
+
+#pragma region instrinct
+		//!!!{{INSTRINCT
+				HI_OPCODE_CASE(NullableNewVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __data = *(uint16_t*)(ip + 4);
+					uint32_t __size = *(uint32_t*)(ip + 6);
+				    NewNullableValueType((void*)(localVarBase + __dst), (void*)(localVarBase + __data), __size);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u4_4:
+				HI_OPCODE_CASE(NullableCtorVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint32_t, (*(int32_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __data = *(uint16_t*)(ip + 4);
+					uint32_t __size = *(uint32_t*)(ip + 6);
+				    InitNullableValueType((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __data), __size);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i8_4:
+				HI_OPCODE_CASE(NullableHasValueVar):
+				{
+					uint16_t __result = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint32_t __offset = *(uint32_t*)(ip + 6);
+				    (*(uint32_t*)(localVarBase + __result)) = IsNullableHasValue((*(void**)(localVarBase + __obj)), __offset);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(NullableGetValueOrDefaultVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int64_t, (*(int32_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint32_t __size = *(uint32_t*)(ip + 6);
+				    GetNullableValueOrDefault((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), __size);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u8_4:
+				HI_OPCODE_CASE(NullableGetValueOrDefaultVarVar_1):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint64_t, (*(int32_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __defaultValue = *(uint16_t*)(ip + 6);
+					uint32_t __size = *(uint32_t*)(ip + 8);
+				    GetNullableValueOrDefault((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), (void*)(localVarBase + __defaultValue), __size);
+				    ip += 12;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_12_4:
+				HI_OPCODE_CASE(NullableGetValueVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    Copy12((void*)(localVarBase + __dst), load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), 12));
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint32_t __size = *(uint32_t*)(ip + 6);
+				    GetNullableValue((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), __size);
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InterlockedCompareExchangeVarVarVarVar_i4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __localtion = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+					uint16_t __comparand = *(uint16_t*)(ip + 8);
+				    (*(int32_t*)(localVarBase + __ret)) = HiInterlockedCompareExchange((int32_t*)(*(void**)(localVarBase + __localtion)), (*(int32_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __comparand)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InterlockedCompareExchangeVarVarVarVar_i8):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __localtion = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+					uint16_t __comparand = *(uint16_t*)(ip + 8);
+				    (*(int64_t*)(localVarBase + __ret)) = HiInterlockedCompareExchange((int64_t*)(*(void**)(localVarBase + __localtion)), (*(int64_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __comparand)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InterlockedCompareExchangeVarVarVarVar_pointer):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __localtion = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+					uint16_t __comparand = *(uint16_t*)(ip + 8);
+				    (*(void**)(localVarBase + __ret)) = HiInterlockedCompareExchange((void**)(*(void**)(localVarBase + __localtion)), (*(void**)(localVarBase + __value)), (*(void**)(localVarBase + __comparand)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InterlockedExchangeVarVarVar_i4):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __localtion = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+				    (*(int32_t*)(localVarBase + __ret)) = HiInterlockedExchange((int32_t*)(*(void**)(localVarBase + __localtion)), (*(int32_t*)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_16_4:
+				HI_OPCODE_CASE(InterlockedExchangeVarVarVar_i8):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    Copy16((void*)(localVarBase + __dst), load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), 16));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __localtion = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+				    (*(int64_t*)(localVarBase + __ret)) = HiInterlockedExchange((int64_t*)(*(void**)(localVarBase + __localtion)), (*(int64_t*)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_n_4:
+				HI_OPCODE_CASE(InterlockedExchangeVarVarVar_pointer):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
-				    std::memcpy((void*)(localVarBase + __dst), load_array_elema(arr, (*(int32_t*)(localVarBase + __index)), eleSize), eleSize);
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __localtion = *(uint16_t*)(ip + 4);
+					uint16_t __value = *(uint16_t*)(ip + 6);
+				    (*(void**)(localVarBase + __ret)) = HiInterlockedExchange((void**)(*(void**)(localVarBase + __localtion)), (*(void**)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i1_8:
+				HI_OPCODE_CASE(NewSystemObjectVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int8_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+				(*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::New(il2cpp_defaults.object_class);
+				    ip += 4;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u1_8:
+				HI_OPCODE_CASE(NewVector2VarVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint8_t, (*(int64_t*)(localVarBase + __index)));
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __x = *(uint16_t*)(ip + 4);
+					uint16_t __y = *(uint16_t*)(ip + 6);
+				    *(HtVector2*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y))};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i2_8:
+				HI_OPCODE_CASE(NewVector3VarVarVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int16_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __x = *(uint16_t*)(ip + 4);
+					uint16_t __y = *(uint16_t*)(ip + 6);
+					uint16_t __z = *(uint16_t*)(ip + 8);
+				    *(HtVector3*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z))};
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u2_8:
+				HI_OPCODE_CASE(NewVector4VarVarVarVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint16_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __x = *(uint16_t*)(ip + 4);
+					uint16_t __y = *(uint16_t*)(ip + 6);
+					uint16_t __z = *(uint16_t*)(ip + 8);
+					uint16_t __w = *(uint16_t*)(ip + 10);
+				    *(HtVector4*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z)), (*(float*)(localVarBase + __w))};
+				    ip += 12;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i4_8:
+				HI_OPCODE_CASE(MathAbsVarVar_i4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(int32_t*)(localVarBase + __dst)) = HiMathAbs((*(int32_t*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u4_8:
+				HI_OPCODE_CASE(MathAbsVarVar_i8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint32_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(int64_t*)(localVarBase + __dst)) = HiMathAbs((*(int64_t*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i8_8:
+				HI_OPCODE_CASE(MathAbsVarVar_f4):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int64_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(float*)(localVarBase + __dst)) = HiMathAbs((*(float*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u8_8:
+				HI_OPCODE_CASE(MathAbsVarVar_f8):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint64_t, (*(int64_t*)(localVarBase + __index)));
-				    ip += 8;
-				    continue;
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(double*)(localVarBase + __dst)) = HiMathAbs((*(double*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_12_8:
+				HI_OPCODE_CASE(MathMinVarVarVar_i4):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    Copy12((void*)(localVarBase + __dst), load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), 12));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(int32_t*)(localVarBase + __ret)) = HiMathMin((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_16_8:
+				HI_OPCODE_CASE(MathMinVarVarVar_i8):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    Copy16((void*)(localVarBase + __dst), load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), 16));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(int64_t*)(localVarBase + __ret)) = HiMathMin((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_n_8:
+				HI_OPCODE_CASE(MathMinVarVarVar_f4):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __index = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr)
-				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
-				    std::memcpy((void*)(localVarBase + __dst), load_array_elema(arr, (*(int64_t*)(localVarBase + __index)), eleSize), eleSize);
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(float*)(localVarBase + __ret)) = HiMathMin((*(float*)(localVarBase + __op1)), (*(float*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i1_4:
+				HI_OPCODE_CASE(MathMinVarVarVar_f8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int8_t, (*(int32_t*)(localVarBase + __index)), (*(int8_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(double*)(localVarBase + __ret)) = HiMathMin((*(double*)(localVarBase + __op1)), (*(double*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u1_4:
+				HI_OPCODE_CASE(MathMaxVarVarVar_i4):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint8_t, (*(int32_t*)(localVarBase + __index)), (*(uint8_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(int32_t*)(localVarBase + __ret)) = HiMathMax((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i2_4:
+				HI_OPCODE_CASE(MathMaxVarVarVar_i8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int16_t, (*(int32_t*)(localVarBase + __index)), (*(int16_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(int64_t*)(localVarBase + __ret)) = HiMathMax((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u2_4:
+				HI_OPCODE_CASE(MathMaxVarVarVar_f4):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint16_t, (*(int32_t*)(localVarBase + __index)), (*(uint16_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(float*)(localVarBase + __ret)) = HiMathMax((*(float*)(localVarBase + __op1)), (*(float*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i4_4:
+				HI_OPCODE_CASE(MathMaxVarVarVar_f8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int32_t, (*(int32_t*)(localVarBase + __index)), (*(int32_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(double*)(localVarBase + __ret)) = HiMathMax((*(double*)(localVarBase + __op1)), (*(double*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u4_4:
+				HI_OPCODE_CASE(MathSqrtVarVar_f4):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint32_t, (*(int32_t*)(localVarBase + __index)), (*(uint32_t*)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(float*)(localVarBase + __dst)) = std::sqrt((*(float*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i8_4:
+				HI_OPCODE_CASE(MathSqrtVarVar_f8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int64_t, (*(int32_t*)(localVarBase + __index)), (*(int64_t*)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(double*)(localVarBase + __dst)) = std::sqrt((*(double*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u8_4:
+				HI_OPCODE_CASE(MathFloorVarVar_f4):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint64_t, (*(int32_t*)(localVarBase + __index)), (*(uint64_t*)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(float*)(localVarBase + __dst)) = std::floor((*(float*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_ref_4:
+				HI_OPCODE_CASE(MathFloorVarVar_f8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_setref((*(Il2CppArray**)(localVarBase + __arr)), (*(int32_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(double*)(localVarBase + __dst)) = std::floor((*(double*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_size_12_4:
+				HI_OPCODE_CASE(MathClampVarVarVarVar_i4):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
-				    Copy12(load_array_elema(_arr, (*(int32_t*)(localVarBase + __index)), 12), (void*)(localVarBase + __ele));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __value = *(uint16_t*)(ip + 4);
+					uint16_t __min = *(uint16_t*)(ip + 6);
+					uint16_t __max = *(uint16_t*)(ip + 8);
+				    (*(int32_t*)(localVarBase + __ret)) = HiMathClamp((*(int32_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __min)), (*(int32_t*)(localVarBase + __max)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_size_16_4:
+				HI_OPCODE_CASE(MathClampVarVarVarVar_i8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
-				    Copy16(load_array_elema(_arr, (*(int32_t*)(localVarBase + __index)), 16), (void*)(localVarBase + __ele));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __value = *(uint16_t*)(ip + 4);
+					uint16_t __min = *(uint16_t*)(ip + 6);
+					uint16_t __max = *(uint16_t*)(ip + 8);
+				    (*(int64_t*)(localVarBase + __ret)) = HiMathClamp((*(int64_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __min)), (*(int64_t*)(localVarBase + __max)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_n_4:
+				HI_OPCODE_CASE(MathClampVarVarVarVar_f4):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_THROW(arr);
-				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
-				    il2cpp_array_setrefwithsize(arr, eleSize, __index, (void*)(localVarBase + __ele));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __value = *(uint16_t*)(ip + 4);
+					uint16_t __min = *(uint16_t*)(ip + 6);
+					uint16_t __max = *(uint16_t*)(ip + 8);
+				    (*(float*)(localVarBase + __ret)) = HiMathClamp((*(float*)(localVarBase + __value)), (*(float*)(localVarBase + __min)), (*(float*)(localVarBase + __max)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i1_8:
+				HI_OPCODE_CASE(MathClampVarVarVarVar_f8):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int8_t, (*(int64_t*)(localVarBase + __index)), (*(int8_t*)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __value = *(uint16_t*)(ip + 4);
+					uint16_t __min = *(uint16_t*)(ip + 6);
+					uint16_t __max = *(uint16_t*)(ip + 8);
+				    (*(double*)(localVarBase + __ret)) = HiMathClamp((*(double*)(localVarBase + __value)), (*(double*)(localVarBase + __min)), (*(double*)(localVarBase + __max)));
+				    ip += 10;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u1_8:
+				HI_OPCODE_CASE(ArrayGetLengthVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint8_t, (*(int64_t*)(localVarBase + __index)), (*(uint8_t*)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __len = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+				    Il2CppArray* __arrObj = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_EX(__arrObj);
+				    (*(int32_t*)(localVarBase + __len)) = (int32_t)il2cpp::vm::Array::GetLength(__arrObj);
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i2_8:
+				HI_OPCODE_CASE(StringGetLengthVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int16_t, (*(int64_t*)(localVarBase + __index)), (*(int16_t*)(localVarBase + __ele)));
+					uint16_t __len = *(uint16_t*)(ip + 2);
+					uint16_t __str = *(uint16_t*)(ip + 4);
+				    Il2CppString* __strObj = (*(Il2CppString**)(localVarBase + __str));
+				    CHECK_NOT_NULL_EX(__strObj);
+				    (*(int32_t*)(localVarBase + __len)) = __strObj->length;
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StringGetCharsVarVarVar):
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __str = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppString* __strObj = (*(Il2CppString**)(localVarBase + __str));
+				    CHECK_NOT_NULL_EX(__strObj);
+				    int32_t __idx = (*(int32_t*)(localVarBase + __index));
+				    if ((uint32_t)__idx >= (uint32_t)__strObj->length)
+				    {
+				        RAISE_EX(il2cpp::vm::Exception::GetIndexOutOfRangeException());
+				    }
+				    (*(int32_t*)(localVarBase + __ret)) = __strObj->chars[__idx];
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u2_8:
+				HI_OPCODE_CASE(Vector2AddVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint16_t, (*(int64_t*)(localVarBase + __index)), (*(uint16_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector2*)(localVarBase + __ret)) = HtVectorAdd((*(HtVector2*)(localVarBase + __op1)), (*(HtVector2*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i4_8:
+				HI_OPCODE_CASE(Vector2SubVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int32_t, (*(int64_t*)(localVarBase + __index)), (*(int32_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector2*)(localVarBase + __ret)) = HtVectorSub((*(HtVector2*)(localVarBase + __op1)), (*(HtVector2*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u4_8:
+				HI_OPCODE_CASE(Vector2NegVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint32_t, (*(int64_t*)(localVarBase + __index)), (*(uint32_t*)(localVarBase + __ele)));
-				    ip += 8;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(HtVector2*)(localVarBase + __dst)) = HtVectorNeg((*(HtVector2*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i8_8:
+				HI_OPCODE_CASE(Vector2MulScalarVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int64_t, (*(int64_t*)(localVarBase + __index)), (*(int64_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __vec = *(uint16_t*)(ip + 4);
+					uint16_t __scalar = *(uint16_t*)(ip + 6);
+				    (*(HtVector2*)(localVarBase + __ret)) = HtVectorMulScalar((*(HtVector2*)(localVarBase + __vec)), (*(float*)(localVarBase + __scalar)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u8_8:
+				HI_OPCODE_CASE(Vector2DivScalarVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint64_t, (*(int64_t*)(localVarBase + __index)), (*(uint64_t*)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __vec = *(uint16_t*)(ip + 4);
+					uint16_t __scalar = *(uint16_t*)(ip + 6);
+				    (*(HtVector2*)(localVarBase + __ret)) = HtVectorDivScalar((*(HtVector2*)(localVarBase + __vec)), (*(float*)(localVarBase + __scalar)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_ref_8:
+				HI_OPCODE_CASE(Vector2DotVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    il2cpp_array_setref((*(Il2CppArray**)(localVarBase + __arr)), (*(int64_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot((*(HtVector2*)(localVarBase + __op1)), (*(HtVector2*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_size_12_8:
+				HI_OPCODE_CASE(Vector2MagnitudeVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
-				    Copy12(load_array_elema(_arr, (*(int64_t*)(localVarBase + __index)), 12), (void*)(localVarBase + __ele));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    (*(float*)(localVarBase + __ret)) = HtVectorMagnitude((**(HtVector2**)(localVarBase + __self)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_size_16_8:
+				HI_OPCODE_CASE(Vector2SqrMagnitudeVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr)
-				    Copy16(load_array_elema(_arr, (*(int64_t*)(localVarBase + __index)), 16), (void*)(localVarBase + __ele));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    HtVector2* __vec = *(HtVector2**)(localVarBase + __self);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot(*__vec, *__vec);
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_n_8:
+				HI_OPCODE_CASE(Vector2NormalizedVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_THROW(arr);
-				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
-				    il2cpp_array_setrefwithsize(arr, eleSize, __index, (void*)(localVarBase + __ele));
-				    ip += 8;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    (*(HtVector2*)(localVarBase + __ret)) = HtVectorNormalize((**(HtVector2**)(localVarBase + __self)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementObjectCheckVarVar_4:
+				HI_OPCODE_CASE(Vector2NormalizeVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-					Il2CppClass* __klass = *(Il2CppClass**)(ip + 8);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    CHECK_ARRAY_TYPE_COMPATIBLE((*(Il2CppArray**)(localVarBase + __arr)), __klass);
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), Il2CppObject*, (*(int32_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
-				    ip += 16;
-				    continue;
+					uint16_t __self = *(uint16_t*)(ip + 2);
+				    HtVector2* __vec = *(HtVector2**)(localVarBase + __self);
+				    *__vec = HtVectorNormalize(*__vec);
+				    ip += 4;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementObjectCheckVarVar_8:
+				HI_OPCODE_CASE(Vector3AddVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __index = *(uint16_t*)(ip + 4);
-					uint16_t __ele = *(uint16_t*)(ip + 6);
-					Il2CppClass* __klass = *(Il2CppClass**)(ip + 8);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    CHECK_ARRAY_TYPE_COMPATIBLE((*(Il2CppArray**)(localVarBase + __arr)), __klass);
-				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), Il2CppObject*, (*(int64_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
-				    ip += 16;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtVectorAdd((*(HtVector3*)(localVarBase + __op1)), (*(HtVector3*)(localVarBase + __op2)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewMdArrVarVar_length:
+				HI_OPCODE_CASE(Vector3SubVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
-					Il2CppClass* __klass = *(Il2CppClass**)(ip + 6);
-				(*(Il2CppArray**)(localVarBase + __arr)) =  NewMdArray(__klass, (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), nullptr);
-				    ip += 14;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtVectorSub((*(HtVector3*)(localVarBase + __op1)), (*(HtVector3*)(localVarBase + __op2)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewMdArrVarVar_length_bound:
+				HI_OPCODE_CASE(Vector3NegVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
-					uint16_t __lowerBoundIdxs = *(uint16_t*)(ip + 6);
-					Il2CppClass* __klass = *(Il2CppClass**)(ip + 8);
-				(*(Il2CppArray**)(localVarBase + __arr)) =  NewMdArray(__klass, (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), (il2cpp_array_size_t*)(void*)(localVarBase + __lowerBoundIdxs));
-				    ip += 16;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(HtVector3*)(localVarBase + __dst)) = HtVectorNeg((*(HtVector3*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar:
+				HI_OPCODE_CASE(Vector3MulScalarVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-				    GetMdArrayElement((*(Il2CppArray**)(localVarBase + __arr)), (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __vec = *(uint16_t*)(ip + 4);
+					uint16_t __scalar = *(uint16_t*)(ip + 6);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtVectorMulScalar((*(HtVector3*)(localVarBase + __vec)), (*(float*)(localVarBase + __scalar)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementAddressVarVar:
+				HI_OPCODE_CASE(Vector3DivScalarVarVarVar):
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
-					uint16_t __arr = *(uint16_t*)(ip + 4);
-					uint16_t __lengthIdxs = *(uint16_t*)(ip + 6);
-				    (*(void**)(localVarBase + __addr)) = GetMdArrayElementAddress((*(Il2CppArray**)(localVarBase + __arr)), (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __vec = *(uint16_t*)(ip + 4);
+					uint16_t __scalar = *(uint16_t*)(ip + 6);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtVectorDivScalar((*(HtVector3*)(localVarBase + __vec)), (*(float*)(localVarBase + __scalar)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar:
+				HI_OPCODE_CASE(Vector3DotVarVarVar):
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-				    SetMdArrayElement((*(Il2CppArray**)(localVarBase + __arr)), (il2cpp_array_size_t*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot((*(HtVector3*)(localVarBase + __op1)), (*(HtVector3*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-
-				//!!!}}ARRAY
-#pragma endregion
-
-#pragma region EXCEPTION
-		//!!!{{EXCEPTION
-				case HiOpcodeEnum::ThrowEx:
+				HI_OPCODE_CASE(Vector3MagnitudeVarVar):
 				{
-					uint16_t __exceptionObj = *(uint16_t*)(ip + 2);
-					THROW_EX((Il2CppException*)(*(Il2CppObject**)(localVarBase + __exceptionObj)));
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    (*(float*)(localVarBase + __ret)) = HtVectorMagnitude((**(HtVector3**)(localVarBase + __self)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RethrowEx:
+				HI_OPCODE_CASE(Vector3SqrMagnitudeVarVar):
 				{
-					RETHROW_EX();
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    HtVector3* __vec = *(HtVector3**)(localVarBase + __self);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot(*__vec, *__vec);
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LeaveEx:
+				HI_OPCODE_CASE(Vector3NormalizedVarVar):
 				{
-					int32_t __offset = *(int32_t*)(ip + 2);
-					LEAVE_EX(__offset);
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtVectorNormalize((**(HtVector3**)(localVarBase + __self)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::EndFilterEx:
+				HI_OPCODE_CASE(Vector3NormalizeVar):
 				{
-					uint16_t __value = *(uint16_t*)(ip + 2);
-					ENDFILTER_EX((*(bool*)(localVarBase + __value)));
+					uint16_t __self = *(uint16_t*)(ip + 2);
+				    HtVector3* __vec = *(HtVector3**)(localVarBase + __self);
+				    *__vec = HtVectorNormalize(*__vec);
 				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::EndFinallyEx:
+				HI_OPCODE_CASE(Vector4AddVarVarVar):
 				{
-					ENDFINALLY_EX();
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector4*)(localVarBase + __ret)) = HtVectorAdd((*(HtVector4*)(localVarBase + __op1)), (*(HtVector4*)(localVarBase + __op2)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-
-				//!!!}}EXCEPTION
-#pragma endregion
-
-#pragma region instrinct
-		//!!!{{INSTRINCT
-				case HiOpcodeEnum::NullableNewVarVar:
+				HI_OPCODE_CASE(Vector4SubVarVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __data = *(uint16_t*)(ip + 4);
-					uint32_t __size = *(uint32_t*)(ip + 6);
-				    NewNullableValueType((void*)(localVarBase + __dst), (void*)(localVarBase + __data), __size);
-				    ip += 10;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector4*)(localVarBase + __ret)) = HtVectorSub((*(HtVector4*)(localVarBase + __op1)), (*(HtVector4*)(localVarBase + __op2)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableCtorVarVar:
+				HI_OPCODE_CASE(Vector4NegVarVar):
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __data = *(uint16_t*)(ip + 4);
-					uint32_t __size = *(uint32_t*)(ip + 6);
-				    InitNullableValueType((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __data), __size);
-				    ip += 10;
-				    continue;
+					uint16_t __src = *(uint16_t*)(ip + 4);
+				    (*(HtVector4*)(localVarBase + __dst)) = HtVectorNeg((*(HtVector4*)(localVarBase + __src)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableHasValueVar:
+				HI_OPCODE_CASE(Vector4MulScalarVarVarVar):
 				{
-					uint16_t __result = *(uint16_t*)(ip + 2);
-					uint16_t __obj = *(uint16_t*)(ip + 4);
-					uint32_t __offset = *(uint32_t*)(ip + 6);
-				    (*(uint32_t*)(localVarBase + __result)) = IsNullableHasValue((*(void**)(localVarBase + __obj)), __offset);
-				    ip += 10;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __vec = *(uint16_t*)(ip + 4);
+					uint16_t __scalar = *(uint16_t*)(ip + 6);
+				    (*(HtVector4*)(localVarBase + __ret)) = HtVectorMulScalar((*(HtVector4*)(localVarBase + __vec)), (*(float*)(localVarBase + __scalar)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableGetValueOrDefaultVarVar:
+				HI_OPCODE_CASE(Vector4DivScalarVarVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __obj = *(uint16_t*)(ip + 4);
-					uint32_t __size = *(uint32_t*)(ip + 6);
-				    GetNullableValueOrDefault((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), __size);
-				    ip += 10;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __vec = *(uint16_t*)(ip + 4);
+					uint16_t __scalar = *(uint16_t*)(ip + 6);
+				    (*(HtVector4*)(localVarBase + __ret)) = HtVectorDivScalar((*(HtVector4*)(localVarBase + __vec)), (*(float*)(localVarBase + __scalar)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableGetValueOrDefaultVarVar_1:
+				HI_OPCODE_CASE(Vector4DotVarVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __obj = *(uint16_t*)(ip + 4);
-					uint16_t __defaultValue = *(uint16_t*)(ip + 6);
-					uint32_t __size = *(uint32_t*)(ip + 8);
-				    GetNullableValueOrDefault((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), (void*)(localVarBase + __defaultValue), __size);
-				    ip += 12;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot((*(HtVector4*)(localVarBase + __op1)), (*(HtVector4*)(localVarBase + __op2)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableGetValueVarVar:
+				HI_OPCODE_CASE(Vector4MagnitudeVarVar):
 				{
-					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint16_t __obj = *(uint16_t*)(ip + 4);
-					uint32_t __size = *(uint32_t*)(ip + 6);
-				    GetNullableValue((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), __size);
-				    ip += 10;
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    (*(float*)(localVarBase + __ret)) = HtVectorMagnitude((**(HtVector4**)(localVarBase + __self)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i4:
+				HI_OPCODE_CASE(Vector4SqrMagnitudeVarVar):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
-					uint16_t __localtion = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-					uint16_t __comparand = *(uint16_t*)(ip + 8);
-				    (*(int32_t*)(localVarBase + __ret)) = HiInterlockedCompareExchange((int32_t*)(*(void**)(localVarBase + __localtion)), (*(int32_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __comparand)));
-				    ip += 10;
-				    continue;
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    HtVector4* __vec = *(HtVector4**)(localVarBase + __self);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot(*__vec, *__vec);
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i8:
+				HI_OPCODE_CASE(Vector4NormalizedVarVar):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
-					uint16_t __localtion = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-					uint16_t __comparand = *(uint16_t*)(ip + 8);
-				    (*(int64_t*)(localVarBase + __ret)) = HiInterlockedCompareExchange((int64_t*)(*(void**)(localVarBase + __localtion)), (*(int64_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __comparand)));
-				    ip += 10;
-				    continue;
+					uint16_t __self = *(uint16_t*)(ip + 4);
+				    (*(HtVector4*)(localVarBase + __ret)) = HtVectorNormalize((**(HtVector4**)(localVarBase + __self)));
+				    ip += 6;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_pointer:
+				HI_OPCODE_CASE(Vector4NormalizeVar):
 				{
-					uint16_t __ret = *(uint16_t*)(ip + 2);
-					uint16_t __localtion = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-					uint16_t __comparand = *(uint16_t*)(ip + 8);
-				    (*(void**)(localVarBase + __ret)) = HiInterlockedCompareExchange((void**)(*(void**)(localVarBase + __localtion)), (*(void**)(localVarBase + __value)), (*(void**)(localVarBase + __comparand)));
-				    ip += 10;
-				    continue;
+					uint16_t __self = *(uint16_t*)(ip + 2);
+				    HtVector4* __vec = *(HtVector4**)(localVarBase + __self);
+				    *__vec = HtVectorNormalize(*__vec);
+				    ip += 4;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedExchangeVarVarVar_i4:
+				HI_OPCODE_CASE(Vector3CrossVarVarVar):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
-					uint16_t __localtion = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-				    (*(int32_t*)(localVarBase + __ret)) = HiInterlockedExchange((int32_t*)(*(void**)(localVarBase + __localtion)), (*(int32_t*)(localVarBase + __value)));
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtVector3Cross((*(HtVector3*)(localVarBase + __op1)), (*(HtVector3*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedExchangeVarVarVar_i8:
+				HI_OPCODE_CASE(QuaternionMulVarVarVar):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
-					uint16_t __localtion = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-				    (*(int64_t*)(localVarBase + __ret)) = HiInterlockedExchange((int64_t*)(*(void**)(localVarBase + __localtion)), (*(int64_t*)(localVarBase + __value)));
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(HtQuaternion*)(localVarBase + __ret)) = HtQuaternionMul((*(HtQuaternion*)(localVarBase + __op1)), (*(HtQuaternion*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedExchangeVarVarVar_pointer:
+				HI_OPCODE_CASE(QuaternionMulVector3VarVarVar):
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
-					uint16_t __localtion = *(uint16_t*)(ip + 4);
-					uint16_t __value = *(uint16_t*)(ip + 6);
-				    (*(void**)(localVarBase + __ret)) = HiInterlockedExchange((void**)(*(void**)(localVarBase + __localtion)), (*(void**)(localVarBase + __value)));
+					uint16_t __rotation = *(uint16_t*)(ip + 4);
+					uint16_t __point = *(uint16_t*)(ip + 6);
+				    (*(HtVector3*)(localVarBase + __ret)) = HtQuaternionMulVector3((*(HtQuaternion*)(localVarBase + __rotation)), (*(HtVector3*)(localVarBase + __point)));
 				    ip += 8;
-				    continue;
-				}
-				case HiOpcodeEnum::NewSystemObjectVar:
-				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-				(*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::New(il2cpp_defaults.object_class);
-				    ip += 4;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector2VarVarVar:
+				HI_OPCODE_CASE(QuaternionDotVarVarVar):
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					uint16_t __x = *(uint16_t*)(ip + 4);
-					uint16_t __y = *(uint16_t*)(ip + 6);
-				    *(HtVector2*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y))};
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					uint16_t __op2 = *(uint16_t*)(ip + 6);
+				    (*(float*)(localVarBase + __ret)) = HtVectorDot((*(HtQuaternion*)(localVarBase + __op1)), (*(HtQuaternion*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
-				}
-				case HiOpcodeEnum::NewVector3VarVarVarVar:
-				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					uint16_t __x = *(uint16_t*)(ip + 4);
-					uint16_t __y = *(uint16_t*)(ip + 6);
-					uint16_t __z = *(uint16_t*)(ip + 8);
-				    *(HtVector3*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z))};
-				    ip += 10;
-				    continue;
-				}
-				case HiOpcodeEnum::NewVector4VarVarVarVarVar:
-				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					uint16_t __x = *(uint16_t*)(ip + 4);
-					uint16_t __y = *(uint16_t*)(ip + 6);
-					uint16_t __z = *(uint16_t*)(ip + 8);
-					uint16_t __w = *(uint16_t*)(ip + 10);
-				    *(HtVector4*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z)), (*(float*)(localVarBase + __w))};
-				    ip += 12;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}INSTRINCT
 #pragma endregion
-				default:
+				HI_OPCODE_DEFAULT:
 					break;
 				}
 			}
@@ -7611,6 +9944,10 @@ else \
 			FIND_NEXT_EX_HANDLER_OR_UNWIND();
 		}
 		return;
+	RaiseInterpException:
+		il2cpp::vm::Exception::PrepareExceptionForThrow(curException, const_cast<MethodInfo*>(imi->method));
+		PREPARE_EXCEPTION();
+		FIND_NEXT_EX_HANDLER_OR_UNWIND();
 	UnWindFail:
 		IL2CPP_ASSERT(curException);
 		interpFrameGroup.CleanUpFrames();
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+
+#include "../CommonDef.h"
+
+namespace huatuo
+{
+namespace interpreter
+{
+
+	// 只增不删的缓存表,读取无锁,写入加锁。
+	// 开放寻址,表项写入后不再修改。扩容时整表复制后替换,Clear时直接丢弃当前表,
+	// 旧表及表项都不释放,保证无锁读取的线程不会访问到已释放的内存。
+	// Hash返回uint32_t,Equal比较两个Key,二者都须是无状态的函数对象。
+	template<typename Key, typename Value, typename Hash, typename Equal>
+	class LockFreeHashMap
+	{
+	public:
+		LockFreeHashMap(uint32_t initCapacity) : _initCapacity(initCapacity), _table(nullptr)
+		{
+			IL2CPP_ASSERT(initCapacity > 0 && (initCapacity & (initCapacity - 1)) == 0);
+		}
+
+		bool TryGetValue(const Key& key, Value& value)
+		{
+			Table* table = il2cpp::os::Atomic::ReadPointer(&_table);
+			if (!table)
+			{
+				return false;
+			}
+			const Entry* entry = FindInTable(table, key, Hash()(key));
+			if (!entry)
+			{
+				return false;
+			}
+			value = entry->value;
+			return true;
+		}
+
+		// key已存在时保留原值
+		void Add(const Key& key, const Value& value)
+		{
+			il2cpp::os::FastAutoLock lock(&_lock);
+			uint32_t hash = Hash()(key);
+			Table* table = _table;
+			if (!table)
+			{
+				table = CreateTable(_initCapacity);
+			}
+			else if (FindInTable(table, key, hash))
+			{
+				return;
+			}
+			else if ((table->count + 1) * 4 > table->capacity * 3)
+			{
+				Table* newTable = CreateTable(table->capacity * 2);
+				for (uint32_t i = 0; i < table->capacity; i++)
+				{
+					Entry* entry = table->entries[i];
+					if (entry)
+					{
+						InsertToTable(newTable, entry, Hash()(entry->key));
+					}
+				}
+				table = newTable;
+			}
+			Entry* newEntry = (Entry*)IL2CPP_MALLOC(sizeof(Entry));
+			new (newEntry) Entry{ key, value };
+			InsertToTable(table, newEntry, hash);
+			il2cpp::os::Atomic::ExchangePointer(&_table, table);
+		}
+
+		void Clear()
+		{
+			il2cpp::os::FastAutoLock lock(&_lock);
+			il2cpp::os::Atomic::ExchangePointer(&_table, (Table*)nullptr);
+		}
+
+	private:
+		struct Entry
+		{
+			Key key;
+			Value value;
+		};
+
+		struct Table
+		{
+			uint32_t capacity;
+			uint32_t count;
+			Entry* entries[1];
+		};
+
+		static Table* CreateTable(uint32_t capacity)
+		{
+			size_t size = sizeof(Table) + (capacity - 1) * sizeof(Entry*);
+			Table* table = (Table*)IL2CPP_MALLOC_ZERO(size);
+			table->capacity = capacity;
+			table->count = 0;
+			return table;
+		}
+
+		static const Entry* FindInTable(Table* table, const Key& key, uint32_t hash)
+		{
+			uint32_t mask = table->capacity - 1;
+			for (uint32_t i = hash & mask; ; i = (i + 1) & mask)
+			{
+				Entry* entry = il2cpp::os::Atomic::ReadPointer(&table->entries[i]);
+				if (!entry || Equal()(entry->key, key))
+				{
+					return entry;
+				}
+			}
+		}
+
+		static void InsertToTable(Table* table, Entry* newEntry, uint32_t hash)
+		{
+			uint32_t mask = table->capacity - 1;
+			for (uint32_t i = hash & mask; ; i = (i + 1) & mask)
+			{
+				if (!table->entries[i])
+				{
+					il2cpp::os::Atomic::ExchangePointer(&table->entries[i], newEntry);
+					++table->count;
+					return;
+				}
+			}
+		}
+
+		const uint32_t _initCapacity;
+		Table* _table;
+		baselib::ReentrantLock _lock;
+	};
+}
+}
@@ -0,0 +1,162 @@
+#include "PretransformTask.h"
+
+#include "os/Atomic.h"
+#include "vm/Assembly.h"
+#include "vm/Domain.h"
+#include "vm/Thread.h"
+
+#include "InterpreterModule.h"
+#include "../metadata/MetadataModule.h"
+#include "../metadata/MetadataUtil.h"
+
+namespace huatuo
+{
+namespace interpreter
+{
+
+	PretransformTask::PretransformTask(metadata::Image* image, const uint32_t* priorityMethodTokens, int32_t priorityMethodCount)
+		: _image(image), _nextIndex(0), _processedCount(0), _failedCount(0), _runningThreadCount(0), _cancelled(0)
+	{
+		uint32_t methodCount = image->GetMethodCount();
+		std::vector<bool> added(methodCount);
+		_methodIndexes.reserve(methodCount);
+		for (int32_t i = 0; i < priorityMethodCount; i++)
+		{
+			uint32_t token = priorityMethodTokens[i];
+			uint32_t rowIndex = metadata::DecodeTokenRowIndex(token);
+			if (metadata::DecodeTokenTableType(token) != metadata::TableType::METHOD || rowIndex == 0 || rowIndex > methodCount || added[rowIndex - 1])
+			{
+				continue;
+			}
+			added[rowIndex - 1] = true;
+			_methodIndexes.push_back(rowIndex - 1);
+		}
+		for (uint32_t i = 0; i < methodCount; i++)
+		{
+			if (!added[i])
+			{
+				_methodIndexes.push_back(i);
+			}
+		}
+	}
+
+	PretransformTask::~PretransformTask()
+	{
+		Cancel();
+		Wait();
+	}
+
+	void PretransformTask::Start(int32_t threadCount)
+	{
+		IL2CPP_ASSERT(_threads.empty());
+		threadCount = std::max(threadCount, 1);
+		_runningThreadCount = threadCount;
+		for (int32_t i = 0; i < threadCount; i++)
+		{
+			il2cpp::os::Thread* thread = new il2cpp::os::Thread();
+			if (thread->Run(WorkerThreadMain, this) == il2cpp::os::kErrorCodeSuccess)
+			{
+				_threads.push_back(thread);
+			}
+			else
+			{
+				// 未启动的线程不能Join
+				delete thread;
+				il2cpp::os::Atomic::Decrement(&_runningThreadCount);
+			}
+		}
+	}
+
+	void PretransformTask::Cancel()
+	{
+		il2cpp::os::Atomic::Exchange(&_cancelled, 1);
+	}
+
+	void PretransformTask::Wait()
+	{
+		for (il2cpp::os::Thread* thread : _threads)
+		{
+			thread->Join();
+			delete thread;
+		}
+		_threads.clear();
+	}
+
+	void PretransformTask::GetProgress(PretransformProgress& progress)
+	{
+		progress.totalCount = (int32_t)_methodIndexes.size();
+		progress.processedCount = il2cpp::os::Atomic::Add(&_processedCount, 0);
+		progress.failedCount = il2cpp::os::Atomic::Add(&_failedCount, 0);
+		progress.finished = il2cpp::os::Atomic::Add(&_runningThreadCount, 0) == 0;
+	}
+
+	void PretransformTask::WorkerThreadMain(void* arg)
+	{
+		PretransformTask* task = (PretransformTask*)arg;
+		// 转换过程中会创建托管对象(如字符串常量),线程需附加到运行时
+		Il2CppThread* thread = il2cpp::vm::Thread::Attach(il2cpp::vm::Domain::GetRoot());
+		task->TransformMethods();
+		il2cpp::vm::Thread::Detach(thread);
+		il2cpp::os::Atomic::Decrement(&task->_runningThreadCount);
+	}
+
+	void PretransformTask::TransformMethods()
+	{
+		int32_t methodCount = (int32_t)_methodIndexes.size();
+		while (!il2cpp::os::Atomic::Add(&_cancelled, 0))
+		{
+			int32_t index = il2cpp::os::Atomic::Increment(&_nextIndex) - 1;
+			if (index >= methodCount)
+			{
+				break;
+			}
+			try
+			{
+				const MethodInfo* method = _image->GetMethodInfoFromMethodDefinitionRawIndex(_methodIndexes[index]);
+				if (method->is_generic || method->klass->is_generic || !_image->GetMethodBody(method->token).ilcodes)
+				{
+					il2cpp::os::Atomic::Increment(&_processedCount);
+					continue;
+				}
+				InterpreterModule::GetInterpMethodInfo(_image, method);
+				il2cpp::os::Atomic::Increment(&_processedCount);
+			}
+			catch (Il2CppExceptionWrapper&)
+			{
+				// 函数首次执行时会再次转换并抛出异常
+				il2cpp::os::Atomic::Increment(&_failedCount);
+			}
+		}
+	}
+}
+}
+
+void* huatuo_pretransform_assembly(const char* assemblyName, int32_t threadCount, const uint32_t* priorityMethodTokens, int32_t priorityMethodCount)
+{
+	const Il2CppAssembly* ass = il2cpp::vm::Assembly::GetLoadedAssembly(assemblyName);
+	if (!ass || !huatuo::metadata::IsInterpreterImage(ass->image))
+	{
+		return nullptr;
+	}
+	return huatuo::interpreter::InterpreterModule::PretransformAssembly(huatuo::metadata::MetadataModule::GetImage(ass->image), threadCount, priorityMethodTokens, priorityMethodCount);
+}
+
+bool huatuo_pretransform_get_progress(void* task, int32_t* totalCount, int32_t* processedCount, int32_t* failedCount)
+{
+	huatuo::interpreter::PretransformProgress progress;
+	((huatuo::interpreter::PretransformTask*)task)->GetProgress(progress);
+	*totalCount = progress.totalCount;
+	*processedCount = progress.processedCount;
+	*failedCount = progress.failedCount;
+	return progress.finished;
+}
+
+void huatuo_pretransform_cancel(void* task)
+{
+	((huatuo::interpreter::PretransformTask*)task)->Cancel();
+}
+
+void huatuo_pretransform_free(void* task)
+{
+	delete (huatuo::interpreter::PretransformTask*)task;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+
+#include "os/Thread.h"
+
+#include "../CommonDef.h"
+#include "../metadata/Image.h"
+
+namespace huatuo
+{
+namespace interpreter
+{
+
+	struct PretransformProgress
+	{
+		int32_t totalCount;
+		int32_t processedCount; // 包含跳过的泛型函数及无函数体的函数
+		int32_t failedCount;
+		bool finished;
+	};
+
+	// 在后台线程中预先转换一个程序集的全部非泛型函数,使主线程首次调用时不必再转换。
+	// 优先转换priorityMethodTokens中的函数(如上次运行时记录的热点函数),其余按定义顺序转换。
+	class PretransformTask
+	{
+	public:
+		PretransformTask(metadata::Image* image, const uint32_t* priorityMethodTokens, int32_t priorityMethodCount);
+		~PretransformTask();
+
+		void Start(int32_t threadCount);
+
+		// 取消后已开始的函数会转换完成,未开始的不再处理
+		void Cancel();
+		void Wait();
+
+		void GetProgress(PretransformProgress& progress);
+
+	private:
+		static void WorkerThreadMain(void* arg);
+		void TransformMethods();
+
+		metadata::Image* _image;
+		std::vector<uint32_t> _methodIndexes;
+		std::vector<il2cpp::os::Thread*> _threads;
+		int32_t _nextIndex;
+		int32_t _processedCount;
+		int32_t _failedCount;
+		int32_t _runningThreadCount;
+		int32_t _cancelled;
+	};
+}
+}
+
+extern "C"
+{
+	// 返回任务句柄,程序集未加载时返回nullptr。句柄需用huatuo_pretransform_free释放
+	IL2CPP_EXPORT void* huatuo_pretransform_assembly(const char* assemblyName, int32_t threadCount, const uint32_t* priorityMethodTokens, int32_t priorityMethodCount);
+	// 返回任务是否已结束
+	IL2CPP_EXPORT bool huatuo_pretransform_get_progress(void* task, int32_t* totalCount, int32_t* processedCount, int32_t* failedCount);
+	IL2CPP_EXPORT void huatuo_pretransform_cancel(void* task);
+	IL2CPP_EXPORT void huatuo_pretransform_free(void* task);
+}
@@ -0,0 +1,92 @@
+#include "ReservedMemory.h"
+
+#include <algorithm>
+
+#include "vm/Exception.h"
+
+#if HUATUO_SUPPORT_RESERVE_MEMORY
+#if IL2CPP_TARGET_WINDOWS
+#include "os/Win32/WindowsHeaders.h"
+#define HUATUO_RESERVE_BY_VIRTUAL_ALLOC 1
+#else
+#include <sys/mman.h>
+#define HUATUO_RESERVE_BY_MMAP 1
+#endif
+#endif
+
+namespace huatuo
+{
+namespace interpreter
+{
+
+	// 每次至少提交这么多,并且按已提交大小翻倍增长,避免频繁提交
+	const size_t kCommitGranularity = 64 * 1024;
+
+	static size_t AlignUp(size_t size, size_t alignment)
+	{
+		return (size + alignment - 1) / alignment * alignment;
+	}
+
+	void ReservedMemory::Reserve(size_t reservedSize)
+	{
+		IL2CPP_ASSERT(!_base);
+		reservedSize = AlignUp(reservedSize, kCommitGranularity);
+#if HUATUO_RESERVE_BY_VIRTUAL_ALLOC
+		_base = (byte*)::VirtualAlloc(nullptr, reservedSize, MEM_RESERVE, PAGE_NOACCESS);
+		_committedSize = 0;
+#elif HUATUO_RESERVE_BY_MMAP
+		void* addr = ::mmap(nullptr, reservedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		_base = addr != MAP_FAILED ? (byte*)addr : nullptr;
+		_committedSize = 0;
+#else
+		_base = (byte*)IL2CPP_CALLOC(1, reservedSize);
+		_committedSize = reservedSize;
+#endif
+		if (!_base)
+		{
+			il2cpp::vm::Exception::RaiseOutOfMemoryException();
+		}
+		_reservedSize = reservedSize;
+	}
+
+	void ReservedMemory::Release()
+	{
+		if (!_base)
+		{
+			return;
+		}
+#if HUATUO_RESERVE_BY_VIRTUAL_ALLOC
+		::VirtualFree(_base, 0, MEM_RELEASE);
+#elif HUATUO_RESERVE_BY_MMAP
+		::munmap(_base, _reservedSize);
+#else
+		IL2CPP_FREE(_base);
+#endif
+		_base = nullptr;
+		_reservedSize = 0;
+		_committedSize = 0;
+	}
+
+	bool ReservedMemory::CommitSlow(size_t size)
+	{
+		if (size > _reservedSize)
+		{
+			return false;
+		}
+		size_t newCommittedSize = std::min(std::max(AlignUp(size, kCommitGranularity), _committedSize * 2), _reservedSize);
+#if HUATUO_RESERVE_BY_VIRTUAL_ALLOC
+		if (!::VirtualAlloc(_base + _committedSize, newCommittedSize - _committedSize, MEM_COMMIT, PAGE_READWRITE))
+		{
+			return false;
+		}
+#elif HUATUO_RESERVE_BY_MMAP
+		if (::mprotect(_base + _committedSize, newCommittedSize - _committedSize, PROT_READ | PROT_WRITE) != 0)
+		{
+			return false;
+		}
+#endif
+		_committedSize = newCommittedSize;
+		return true;
+	}
+}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../CommonDef.h"
+
+namespace huatuo
+{
+namespace interpreter
+{
+
+	// 预留一段连续的虚拟地址空间,使用时再按需提交物理内存。基址始终不变,
+	// 解释器栈上保存的指针一直有效。HUATUO_SUPPORT_RESERVE_MEMORY为0的平台在Reserve时一次性分配。
+	class ReservedMemory
+	{
+	public:
+		ReservedMemory() : _base(nullptr), _reservedSize(0), _committedSize(0)
+		{
+
+		}
+
+		~ReservedMemory()
+		{
+			Release();
+		}
+
+		void Reserve(size_t reservedSize);
+		void Release();
+
+		// 保证[0, size)已提交,新提交的内存内容为0。超出预留大小或提交失败时返回false
+		bool Commit(size_t size)
+		{
+			return size <= _committedSize || CommitSlow(size);
+		}
+
+		byte* GetBase() const
+		{
+			return _base;
+		}
+
+		size_t GetReservedSize() const
+		{
+			return _reservedSize;
+		}
+
+		size_t GetCommittedSize() const
+		{
+			return _committedSize;
+		}
+
+	private:
+		bool CommitSlow(size_t size);
+
+		byte* _base;
+		size_t _reservedSize;
+		size_t _committedSize;
+	};
+}
+}
@@ -7,6 +7,8 @@ namespace huatuo
 namespace metadata
 {
 
+    bool GetMappedFileBuffer(const char* assemblyFile, void*& buf, uint64_t& fileLength);
+
     class Assembly
     {
     public:
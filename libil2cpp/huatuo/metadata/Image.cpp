@@ -1288,9 +1288,17 @@ namespace metadata
 				clrStr = il2cpp::vm::String::NewUtf16((const Il2CppChar*)str, (stringLength - 1) / 2);
 			}
 			_il2cppStringCache.Add(index, clrStr);
+			_il2cppStringIndexes.insert({ clrStr, index });
 			return clrStr;
 		}
 	}
 
+	const byte* Image::GetModuleMvid()
+	{
+		TbModule data = TableReader::ReadModule(*this, 1);
+		IL2CPP_ASSERT(data.mvid > 0 && data.mvid * 16 <= _streamGuidHeap.size);
+		return _streamGuidHeap.data + (data.mvid - 1) * 16;
+	}
+
 }
 }
\ No newline at end of file
@@ -151,6 +151,11 @@ namespace metadata
 			return _tables[(int)TableType::EXPORTEDTYPE].rowNum;
 		}
 
+		uint32_t GetMethodCount() const
+		{
+			return _tables[(int)TableType::METHOD].rowNum;
+		}
+
 		MethodBody& GetMethodBody(uint32_t token)
 		{
 			IL2CPP_ASSERT(DecodeTokenTableType(token) == TableType::METHOD);
@@ -188,6 +193,19 @@ namespace metadata
 		}
 
 		Il2CppString* GetIl2CppUserStringFromRawIndex(StringIndex index);
+		bool TryGetUserStringRawIndex(Il2CppString* str, StringIndex& index) const
+		{
+			auto it = _il2cppStringIndexes.find(str);
+			if (it != _il2cppStringIndexes.end())
+			{
+				index = it->second;
+				return true;
+			}
+			return false;
+		}
+
+		// Module表中的MVID,每次编译dll都会重新生成
+		const byte* GetModuleMvid();
 
 		const byte* GetBlobFromRawIndex(StringIndex index) const
 		{
@@ -586,6 +604,7 @@ namespace metadata
 
 		std::unordered_map<std::tuple<uint32_t, const Il2CppGenericContext*>, void*, TokenGenericContextTypeHash, TokenGenericContextTypeEqual> _token2ResolvedDataCache;
 		il2cpp::gc::AppendOnlyGCHashMap<uint32_t, Il2CppString*, std::hash<uint32_t>> _il2cppStringCache;
+		std::unordered_map<Il2CppString*, StringIndex> _il2cppStringIndexes;
 
 		std::unordered_map<uint32_t, CustomAtttributesInfo> _tokenCustomAttributes;
 		std::vector<Il2CppCustomAttributeTypeRange> _customAttributeHandles;
@@ -205,6 +205,7 @@ namespace metadata
 	// index => MethodDefinition -> DeclaringClass -> index - klass->methodStart -> MethodInfo*
 	const MethodInfo* Image::GetMethodInfoFromMethodDefinitionRawIndex(uint32_t index)
 	{
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
 		IL2CPP_ASSERT((size_t)index <= _methodDefine2InfoCaches.size());
 		if (_methodDefine2InfoCaches[index])
 		{
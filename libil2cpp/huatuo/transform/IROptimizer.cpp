@@ -0,0 +1,995 @@
+#include "IROptimizer.h"
+
+#include <algorithm>
+
+using namespace huatuo::interpreter;
+
+namespace huatuo
+{
+namespace transform
+{
+
+	// CompOp + BranchTrue/BranchFalse 合并后的条件跳转指令。
+	// 浮点比较的否定不等价于反向比较(NaN),BranchFalse 只合并 Ceq。
+	static bool TryGetCompareBranchOpcode(HiOpcodeEnum compOp, bool branchIfTrue, HiOpcodeEnum& branchOp)
+	{
+		switch (compOp)
+		{
+		//!!!{{COMPARE_BRANCH
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Ceq_i4 : HiOpcodeEnum::BranchVarVar_CneUn_i4;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Ceq_i8 : HiOpcodeEnum::BranchVarVar_CneUn_i8;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Ceq_f4 : HiOpcodeEnum::BranchVarVar_CneUn_f4;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Ceq_f8 : HiOpcodeEnum::BranchVarVar_CneUn_f8;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Cgt_i4 : HiOpcodeEnum::BranchVarVar_Cle_i4;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Cgt_i8 : HiOpcodeEnum::BranchVarVar_Cle_i8;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4:
+			branchOp = HiOpcodeEnum::BranchVarVar_Cgt_f4;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8:
+			branchOp = HiOpcodeEnum::BranchVarVar_Cgt_f8;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_CgtUn_i4 : HiOpcodeEnum::BranchVarVar_CleUn_i4;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_CgtUn_i8 : HiOpcodeEnum::BranchVarVar_CleUn_i8;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4:
+			branchOp = HiOpcodeEnum::BranchVarVar_CgtUn_f4;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8:
+			branchOp = HiOpcodeEnum::BranchVarVar_CgtUn_f8;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Clt_i4 : HiOpcodeEnum::BranchVarVar_Cge_i4;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i8:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_Clt_i8 : HiOpcodeEnum::BranchVarVar_Cge_i8;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f4:
+			branchOp = HiOpcodeEnum::BranchVarVar_Clt_f4;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f8:
+			branchOp = HiOpcodeEnum::BranchVarVar_Clt_f8;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_CltUn_i4 : HiOpcodeEnum::BranchVarVar_CgeUn_i4;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8:
+			branchOp = branchIfTrue ? HiOpcodeEnum::BranchVarVar_CltUn_i8 : HiOpcodeEnum::BranchVarVar_CgeUn_i8;
+			return true;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4:
+			branchOp = HiOpcodeEnum::BranchVarVar_CltUn_f4;
+			return branchIfTrue;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8:
+			branchOp = HiOpcodeEnum::BranchVarVar_CltUn_f8;
+			return branchIfTrue;
+		//!!!}}COMPARE_BRANCH
+		default:
+			return false;
+		}
+	}
+
+	static bool TryGetFieldBinOpOpcode(HiOpcodeEnum binOp, int32_t fieldSize, HiOpcodeEnum& fusedOp)
+	{
+		switch (binOp)
+		{
+		//!!!{{FIELD_BINOP
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Add_i4;
+			return fieldSize == 4;
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i8:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Add_i8;
+			return fieldSize == 8;
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Add_f4;
+			return fieldSize == 4;
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f8:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Add_f8;
+			return fieldSize == 8;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i4:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Sub_i4;
+			return fieldSize == 4;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i8:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Sub_i8;
+			return fieldSize == 8;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f4:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Sub_f4;
+			return fieldSize == 4;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f8:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Sub_f8;
+			return fieldSize == 8;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i4:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Mul_i4;
+			return fieldSize == 4;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i8:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Mul_i8;
+			return fieldSize == 8;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Mul_f4;
+			return fieldSize == 4;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f8:
+			fusedOp = HiOpcodeEnum::BinOpVarVarFld_Mul_f8;
+			return fieldSize == 8;
+		//!!!}}FIELD_BINOP
+		default:
+			return false;
+		}
+	}
+
+	static int32_t GetLdfldPrimitiveSize(HiOpcodeEnum ldfldOp)
+	{
+		switch (ldfldOp)
+		{
+		case HiOpcodeEnum::LdfldVarVar_i4:
+		case HiOpcodeEnum::LdfldVarVar_u4:
+			return 4;
+		case HiOpcodeEnum::LdfldVarVar_i8:
+		case HiOpcodeEnum::LdfldVarVar_u8:
+			return 8;
+		default:
+			return 0;
+		}
+	}
+
+	bool IROptimizer::GetOperands(IRCommon* ir, IROperands& ops)
+	{
+		ops.dst = nullptr;
+		ops.srcCount = 0;
+		switch (ir->type)
+		{
+		//!!!{{OPERANDS
+		case HiOpcodeEnum::LdlocVarVar:
+		case HiOpcodeEnum::LdindVarVar_i1:
+		case HiOpcodeEnum::LdindVarVar_u1:
+		case HiOpcodeEnum::LdindVarVar_i2:
+		case HiOpcodeEnum::LdindVarVar_u2:
+		case HiOpcodeEnum::LdindVarVar_i4:
+		case HiOpcodeEnum::LdindVarVar_u4:
+		case HiOpcodeEnum::LdindVarVar_i8:
+		case HiOpcodeEnum::LdindVarVar_f4:
+		case HiOpcodeEnum::LdindVarVar_f8:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_i4:
+		case HiOpcodeEnum::UnaryOpVarVar_Not_i4:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_i8:
+		case HiOpcodeEnum::UnaryOpVarVar_Not_i8:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_f4:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_f8:
+		case HiOpcodeEnum::ConvertVarVar_i1_i1:
+		case HiOpcodeEnum::ConvertVarVar_i1_u1:
+		case HiOpcodeEnum::ConvertVarVar_i1_i2:
+		case HiOpcodeEnum::ConvertVarVar_i1_u2:
+		case HiOpcodeEnum::ConvertVarVar_i1_i4:
+		case HiOpcodeEnum::ConvertVarVar_i1_u4:
+		case HiOpcodeEnum::ConvertVarVar_i1_i8:
+		case HiOpcodeEnum::ConvertVarVar_i1_u8:
+		case HiOpcodeEnum::ConvertVarVar_i1_f4:
+		case HiOpcodeEnum::ConvertVarVar_i1_f8:
+		case HiOpcodeEnum::ConvertVarVar_u1_i1:
+		case HiOpcodeEnum::ConvertVarVar_u1_u1:
+		case HiOpcodeEnum::ConvertVarVar_u1_i2:
+		case HiOpcodeEnum::ConvertVarVar_u1_u2:
+		case HiOpcodeEnum::ConvertVarVar_u1_i4:
+		case HiOpcodeEnum::ConvertVarVar_u1_u4:
+		case HiOpcodeEnum::ConvertVarVar_u1_i8:
+		case HiOpcodeEnum::ConvertVarVar_u1_u8:
+		case HiOpcodeEnum::ConvertVarVar_u1_f4:
+		case HiOpcodeEnum::ConvertVarVar_u1_f8:
+		case HiOpcodeEnum::ConvertVarVar_i2_i1:
+		case HiOpcodeEnum::ConvertVarVar_i2_u1:
+		case HiOpcodeEnum::ConvertVarVar_i2_i2:
+		case HiOpcodeEnum::ConvertVarVar_i2_u2:
+		case HiOpcodeEnum::ConvertVarVar_i2_i4:
+		case HiOpcodeEnum::ConvertVarVar_i2_u4:
+		case HiOpcodeEnum::ConvertVarVar_i2_i8:
+		case HiOpcodeEnum::ConvertVarVar_i2_u8:
+		case HiOpcodeEnum::ConvertVarVar_i2_f4:
+		case HiOpcodeEnum::ConvertVarVar_i2_f8:
+		case HiOpcodeEnum::ConvertVarVar_u2_i1:
+		case HiOpcodeEnum::ConvertVarVar_u2_u1:
+		case HiOpcodeEnum::ConvertVarVar_u2_i2:
+		case HiOpcodeEnum::ConvertVarVar_u2_u2:
+		case HiOpcodeEnum::ConvertVarVar_u2_i4:
+		case HiOpcodeEnum::ConvertVarVar_u2_u4:
+		case HiOpcodeEnum::ConvertVarVar_u2_i8:
+		case HiOpcodeEnum::ConvertVarVar_u2_u8:
+		case HiOpcodeEnum::ConvertVarVar_u2_f4:
+		case HiOpcodeEnum::ConvertVarVar_u2_f8:
+		case HiOpcodeEnum::ConvertVarVar_i4_i1:
+		case HiOpcodeEnum::ConvertVarVar_i4_u1:
+		case HiOpcodeEnum::ConvertVarVar_i4_i2:
+		case HiOpcodeEnum::ConvertVarVar_i4_u2:
+		case HiOpcodeEnum::ConvertVarVar_i4_i4:
+		case HiOpcodeEnum::ConvertVarVar_i4_u4:
+		case HiOpcodeEnum::ConvertVarVar_i4_i8:
+		case HiOpcodeEnum::ConvertVarVar_i4_u8:
+		case HiOpcodeEnum::ConvertVarVar_i4_f4:
+		case HiOpcodeEnum::ConvertVarVar_i4_f8:
+		case HiOpcodeEnum::ConvertVarVar_u4_i1:
+		case HiOpcodeEnum::ConvertVarVar_u4_u1:
+		case HiOpcodeEnum::ConvertVarVar_u4_i2:
+		case HiOpcodeEnum::ConvertVarVar_u4_u2:
+		case HiOpcodeEnum::ConvertVarVar_u4_i4:
+		case HiOpcodeEnum::ConvertVarVar_u4_u4:
+		case HiOpcodeEnum::ConvertVarVar_u4_i8:
+		case HiOpcodeEnum::ConvertVarVar_u4_u8:
+		case HiOpcodeEnum::ConvertVarVar_u4_f4:
+		case HiOpcodeEnum::ConvertVarVar_u4_f8:
+		case HiOpcodeEnum::ConvertVarVar_i8_i1:
+		case HiOpcodeEnum::ConvertVarVar_i8_u1:
+		case HiOpcodeEnum::ConvertVarVar_i8_i2:
+		case HiOpcodeEnum::ConvertVarVar_i8_u2:
+		case HiOpcodeEnum::ConvertVarVar_i8_i4:
+		case HiOpcodeEnum::ConvertVarVar_i8_u4:
+		case HiOpcodeEnum::ConvertVarVar_i8_i8:
+		case HiOpcodeEnum::ConvertVarVar_i8_u8:
+		case HiOpcodeEnum::ConvertVarVar_i8_f4:
+		case HiOpcodeEnum::ConvertVarVar_i8_f8:
+		case HiOpcodeEnum::ConvertVarVar_u8_i1:
+		case HiOpcodeEnum::ConvertVarVar_u8_u1:
+		case HiOpcodeEnum::ConvertVarVar_u8_i2:
+		case HiOpcodeEnum::ConvertVarVar_u8_u2:
+		case HiOpcodeEnum::ConvertVarVar_u8_i4:
+		case HiOpcodeEnum::ConvertVarVar_u8_u4:
+		case HiOpcodeEnum::ConvertVarVar_u8_i8:
+		case HiOpcodeEnum::ConvertVarVar_u8_u8:
+		case HiOpcodeEnum::ConvertVarVar_u8_f4:
+		case HiOpcodeEnum::ConvertVarVar_u8_f8:
+		case HiOpcodeEnum::ConvertVarVar_f4_i1:
+		case HiOpcodeEnum::ConvertVarVar_f4_u1:
+		case HiOpcodeEnum::ConvertVarVar_f4_i2:
+		case HiOpcodeEnum::ConvertVarVar_f4_u2:
+		case HiOpcodeEnum::ConvertVarVar_f4_i4:
+		case HiOpcodeEnum::ConvertVarVar_f4_u4:
+		case HiOpcodeEnum::ConvertVarVar_f4_i8:
+		case HiOpcodeEnum::ConvertVarVar_f4_u8:
+		case HiOpcodeEnum::ConvertVarVar_f4_f4:
+		case HiOpcodeEnum::ConvertVarVar_f4_f8:
+		case HiOpcodeEnum::ConvertVarVar_f8_i1:
+		case HiOpcodeEnum::ConvertVarVar_f8_u1:
+		case HiOpcodeEnum::ConvertVarVar_f8_i2:
+		case HiOpcodeEnum::ConvertVarVar_f8_u2:
+		case HiOpcodeEnum::ConvertVarVar_f8_i4:
+		case HiOpcodeEnum::ConvertVarVar_f8_u4:
+		case HiOpcodeEnum::ConvertVarVar_f8_i8:
+		case HiOpcodeEnum::ConvertVarVar_f8_u8:
+		case HiOpcodeEnum::ConvertVarVar_f8_f4:
+		case HiOpcodeEnum::ConvertVarVar_f8_f8:
+		case HiOpcodeEnum::MathAbsVarVar_i4:
+		case HiOpcodeEnum::MathAbsVarVar_i8:
+		case HiOpcodeEnum::MathAbsVarVar_f4:
+		case HiOpcodeEnum::MathAbsVarVar_f8:
+		case HiOpcodeEnum::MathSqrtVarVar_f4:
+		case HiOpcodeEnum::MathSqrtVarVar_f8:
+		case HiOpcodeEnum::MathFloorVarVar_f4:
+		case HiOpcodeEnum::MathFloorVarVar_f8:
+		{
+			IRLdlocVarVar* ir2 = (IRLdlocVarVar*)ir;
+			ops.dst = &ir2->dst;
+			ops.srcs[ops.srcCount++] = &ir2->src;
+			return true;
+		}
+		case HiOpcodeEnum::GetArrayLengthVarVar_4:
+		case HiOpcodeEnum::GetArrayLengthVarVar_8:
+		{
+			IRGetArrayLengthVarVar_4* ir2 = (IRGetArrayLengthVarVar_4*)ir;
+			ops.dst = &ir2->len;
+			ops.srcs[ops.srcCount++] = &ir2->arr;
+			return true;
+		}
+		case HiOpcodeEnum::BinOpVarVarFld_Add_i4:
+		case HiOpcodeEnum::BinOpVarVarFld_Add_i8:
+		case HiOpcodeEnum::BinOpVarVarFld_Add_f4:
+		case HiOpcodeEnum::BinOpVarVarFld_Add_f8:
+		case HiOpcodeEnum::BinOpVarVarFld_Sub_i4:
+		case HiOpcodeEnum::BinOpVarVarFld_Sub_i8:
+		case HiOpcodeEnum::BinOpVarVarFld_Sub_f4:
+		case HiOpcodeEnum::BinOpVarVarFld_Sub_f8:
+		case HiOpcodeEnum::BinOpVarVarFld_Mul_i4:
+		case HiOpcodeEnum::BinOpVarVarFld_Mul_i8:
+		case HiOpcodeEnum::BinOpVarVarFld_Mul_f4:
+		case HiOpcodeEnum::BinOpVarVarFld_Mul_f8:
+		{
+			IRBinOpVarVarFld_Add_i4* ir2 = (IRBinOpVarVarFld_Add_i4*)ir;
+			ops.dst = &ir2->ret;
+			ops.srcs[ops.srcCount++] = &ir2->op1;
+			ops.srcs[ops.srcCount++] = &ir2->obj;
+			return true;
+		}
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_MulUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_DivUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_RemUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_And_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_MulUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_DivUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_RemUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_And_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_f8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i8:
+		case HiOpcodeEnum::MathMinVarVarVar_i4:
+		case HiOpcodeEnum::MathMinVarVarVar_i8:
+		case HiOpcodeEnum::MathMinVarVarVar_f4:
+		case HiOpcodeEnum::MathMinVarVarVar_f8:
+		case HiOpcodeEnum::MathMaxVarVarVar_i4:
+		case HiOpcodeEnum::MathMaxVarVarVar_i8:
+		case HiOpcodeEnum::MathMaxVarVarVar_f4:
+		case HiOpcodeEnum::MathMaxVarVarVar_f8:
+		{
+			IRBinOpVarVarVar_Add_i4* ir2 = (IRBinOpVarVarVar_Add_i4*)ir;
+			ops.dst = &ir2->ret;
+			ops.srcs[ops.srcCount++] = &ir2->op1;
+			ops.srcs[ops.srcCount++] = &ir2->op2;
+			return true;
+		}
+		case HiOpcodeEnum::MathClampVarVarVarVar_i4:
+		case HiOpcodeEnum::MathClampVarVarVarVar_i8:
+		case HiOpcodeEnum::MathClampVarVarVarVar_f4:
+		case HiOpcodeEnum::MathClampVarVarVarVar_f8:
+		{
+			IRMathClampVarVarVarVar_i4* ir2 = (IRMathClampVarVarVarVar_i4*)ir;
+			ops.dst = &ir2->ret;
+			ops.srcs[ops.srcCount++] = &ir2->value;
+			ops.srcs[ops.srcCount++] = &ir2->min;
+			ops.srcs[ops.srcCount++] = &ir2->max;
+			return true;
+		}
+		case HiOpcodeEnum::ArrayGetLengthVarVar:
+		{
+			IRArrayGetLengthVarVar* ir2 = (IRArrayGetLengthVarVar*)ir;
+			ops.dst = &ir2->len;
+			ops.srcs[ops.srcCount++] = &ir2->arr;
+			return true;
+		}
+		case HiOpcodeEnum::StringGetLengthVarVar:
+		{
+			IRStringGetLengthVarVar* ir2 = (IRStringGetLengthVarVar*)ir;
+			ops.dst = &ir2->len;
+			ops.srcs[ops.srcCount++] = &ir2->str;
+			return true;
+		}
+		case HiOpcodeEnum::StringGetCharsVarVarVar:
+		{
+			IRStringGetCharsVarVarVar* ir2 = (IRStringGetCharsVarVarVar*)ir;
+			ops.dst = &ir2->ret;
+			ops.srcs[ops.srcCount++] = &ir2->str;
+			ops.srcs[ops.srcCount++] = &ir2->index;
+			return true;
+		}
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8:
+		{
+			IRCompOpVarVarVar_Ceq_i4* ir2 = (IRCompOpVarVarVar_Ceq_i4*)ir;
+			ops.dst = &ir2->ret;
+			ops.srcs[ops.srcCount++] = &ir2->c1;
+			ops.srcs[ops.srcCount++] = &ir2->c2;
+			return true;
+		}
+		case HiOpcodeEnum::GetArrayElementVarVar_i1_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_u1_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_i2_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_u2_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_i4_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_u4_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_i8_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_u8_4:
+		case HiOpcodeEnum::GetArrayElementVarVar_i1_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_u1_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_i2_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_u2_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_i4_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_u4_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_i8_8:
+		case HiOpcodeEnum::GetArrayElementVarVar_u8_8:
+		{
+			IRGetArrayElementVarVar_i4_4* ir2 = (IRGetArrayElementVarVar_i4_4*)ir;
+			ops.dst = &ir2->dst;
+			ops.srcs[ops.srcCount++] = &ir2->arr;
+			ops.srcs[ops.srcCount++] = &ir2->index;
+			return true;
+		}
+		case HiOpcodeEnum::LdfldVarVar_i1:
+		case HiOpcodeEnum::LdfldVarVar_u1:
+		case HiOpcodeEnum::LdfldVarVar_i2:
+		case HiOpcodeEnum::LdfldVarVar_u2:
+		case HiOpcodeEnum::LdfldVarVar_i4:
+		case HiOpcodeEnum::LdfldVarVar_u4:
+		case HiOpcodeEnum::LdfldVarVar_i8:
+		case HiOpcodeEnum::LdfldVarVar_u8:
+		{
+			IRLdfldVarVar_i4* ir2 = (IRLdfldVarVar_i4*)ir;
+			ops.dst = &ir2->dst;
+			ops.srcs[ops.srcCount++] = &ir2->obj;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_1:
+		{
+			IRLdcVarConst_1* ir2 = (IRLdcVarConst_1*)ir;
+			ops.dst = &ir2->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_2:
+		{
+			IRLdcVarConst_2* ir2 = (IRLdcVarConst_2*)ir;
+			ops.dst = &ir2->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_4:
+		{
+			IRLdcVarConst_4* ir2 = (IRLdcVarConst_4*)ir;
+			ops.dst = &ir2->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_8:
+		{
+			IRLdcVarConst_8* ir2 = (IRLdcVarConst_8*)ir;
+			ops.dst = &ir2->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdnullVar:
+		{
+			IRLdnullVar* ir2 = (IRLdnullVar*)ir;
+			ops.dst = &ir2->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdftnVar:
+		{
+			IRLdftnVar* ir2 = (IRLdftnVar*)ir;
+			ops.dst = &ir2->dst;
+			return true;
+		}
+		case HiOpcodeEnum::BranchTrueVar_i4:
+		case HiOpcodeEnum::BranchTrueVar_i8:
+		case HiOpcodeEnum::BranchFalseVar_i4:
+		case HiOpcodeEnum::BranchFalseVar_i8:
+		{
+			IRBranchTrueVar_i4* ir2 = (IRBranchTrueVar_i4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->op;
+			return true;
+		}
+		case HiOpcodeEnum::BranchVarVar_Ceq_i4:
+		case HiOpcodeEnum::BranchVarVar_Ceq_i8:
+		case HiOpcodeEnum::BranchVarVar_Ceq_f4:
+		case HiOpcodeEnum::BranchVarVar_Ceq_f8:
+		case HiOpcodeEnum::BranchVarVar_CneUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CneUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CneUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CneUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i8:
+		case HiOpcodeEnum::BranchVarVar_Cgt_f4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_f8:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cge_i4:
+		case HiOpcodeEnum::BranchVarVar_Cge_i8:
+		case HiOpcodeEnum::BranchVarVar_Cge_f4:
+		case HiOpcodeEnum::BranchVarVar_Cge_f8:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Clt_i4:
+		case HiOpcodeEnum::BranchVarVar_Clt_i8:
+		case HiOpcodeEnum::BranchVarVar_Clt_f4:
+		case HiOpcodeEnum::BranchVarVar_Clt_f8:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CltUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cle_i4:
+		case HiOpcodeEnum::BranchVarVar_Cle_i8:
+		case HiOpcodeEnum::BranchVarVar_Cle_f4:
+		case HiOpcodeEnum::BranchVarVar_Cle_f8:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CleUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_f8:
+		{
+			IRBranchVarVar_Ceq_i4* ir2 = (IRBranchVarVar_Ceq_i4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->op1;
+			ops.srcs[ops.srcCount++] = &ir2->op2;
+			return true;
+		}
+		case HiOpcodeEnum::BranchVarArrayLength_Clt_i4:
+		case HiOpcodeEnum::BranchVarArrayLength_Cge_i4:
+		{
+			IRBranchVarArrayLength_Clt_i4* ir2 = (IRBranchVarArrayLength_Clt_i4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->op;
+			ops.srcs[ops.srcCount++] = &ir2->arr;
+			return true;
+		}
+		case HiOpcodeEnum::StindVarVar_i1:
+		case HiOpcodeEnum::StindVarVar_i2:
+		case HiOpcodeEnum::StindVarVar_i4:
+		case HiOpcodeEnum::StindVarVar_i8:
+		case HiOpcodeEnum::StindVarVar_f4:
+		case HiOpcodeEnum::StindVarVar_f8:
+		{
+			IRStindVarVar_i4* ir2 = (IRStindVarVar_i4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->dst;
+			ops.srcs[ops.srcCount++] = &ir2->src;
+			return true;
+		}
+		case HiOpcodeEnum::StfldVarVar_i1:
+		case HiOpcodeEnum::StfldVarVar_u1:
+		case HiOpcodeEnum::StfldVarVar_i2:
+		case HiOpcodeEnum::StfldVarVar_u2:
+		case HiOpcodeEnum::StfldVarVar_i4:
+		case HiOpcodeEnum::StfldVarVar_u4:
+		case HiOpcodeEnum::StfldVarVar_i8:
+		case HiOpcodeEnum::StfldVarVar_u8:
+		{
+			IRStfldVarVar_i4* ir2 = (IRStfldVarVar_i4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->obj;
+			ops.srcs[ops.srcCount++] = &ir2->data;
+			return true;
+		}
+		case HiOpcodeEnum::SetArrayElementVarVar_i1_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_u1_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_i2_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_u2_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_i4_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_u4_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_i8_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_u8_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_ref_4:
+		case HiOpcodeEnum::SetArrayElementVarVar_i1_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_u1_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_i2_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_u2_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_i4_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_u4_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_i8_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_u8_8:
+		case HiOpcodeEnum::SetArrayElementVarVar_ref_8:
+		{
+			IRSetArrayElementVarVar_i4_4* ir2 = (IRSetArrayElementVarVar_i4_4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->arr;
+			ops.srcs[ops.srcCount++] = &ir2->index;
+			ops.srcs[ops.srcCount++] = &ir2->ele;
+			return true;
+		}
+		case HiOpcodeEnum::RetVar_ret_8:
+		{
+			IRRetVar_ret_8* ir2 = (IRRetVar_ret_8*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->ret;
+			return true;
+		}
+		case HiOpcodeEnum::CheckFiniteVar_f4:
+		case HiOpcodeEnum::CheckFiniteVar_f8:
+		{
+			IRCheckFiniteVar_f4* ir2 = (IRCheckFiniteVar_f4*)ir;
+			ops.srcs[ops.srcCount++] = &ir2->src;
+			return true;
+		}
+		//!!!}}OPERANDS
+		default:
+			return false;
+		}
+	}
+
+	void IROptimizer::ComputeAddressTakenVars()
+	{
+		_addressTaken = _pool.NewNAny<bool>(_maxStackSize);
+		std::memset(_addressTaken, 0, _maxStackSize);
+		for (IRBasicBlock* bb : _irbbs)
+		{
+			for (IRCommon* ir : bb->insts)
+			{
+				if (ir->type == HiOpcodeEnum::LdlocVarAddress)
+				{
+					_addressTaken[((IRLdlocVarAddress*)ir)->src] = true;
+				}
+			}
+		}
+	}
+
+	void IROptimizer::RemoveDeletedInsts(IRBasicBlock* bb)
+	{
+		auto& insts = bb->insts;
+		insts.erase(std::remove(insts.begin(), insts.end(), nullptr), insts.end());
+	}
+
+	void IROptimizer::PropagateCopies()
+	{
+		ComputeAddressTakenVars();
+		for (IRBasicBlock* bb : _irbbs)
+		{
+			if (bb->insts.empty())
+			{
+				continue;
+			}
+			ForwardCopies(bb);
+			ForwardStores(bb);
+		}
+	}
+
+	// 基本块内的前向复制传播。ldloc/ldarg/dup 生成的 LdlocVarVar 的源变量直接替换到后续指令的操作数,
+	// 所有读取都被替换且目标eval stack变量已被覆盖或离开基本块后不再存活的move指令被删除。
+	void IROptimizer::ForwardCopies(IRBasicBlock* bb)
+	{
+		auto& insts = bb->insts;
+		std::vector<CopyInfo> copies;
+		bool hasDeleted = false;
+
+		auto killCopies = [&](uint16_t var)
+		{
+			for (size_t k = 0; k < copies.size(); )
+			{
+				CopyInfo& ci = copies[k];
+				if (ci.dst == var)
+				{
+					// 新值覆盖了复制的结果。之前的读取全部已被替换,这条move已没有用处
+					insts[ci.instIdx] = nullptr;
+					hasDeleted = true;
+					copies.erase(copies.begin() + k);
+				}
+				else if (ci.src == var)
+				{
+					// 源变量被修改,之后只能从复制的结果读取
+					copies.erase(copies.begin() + k);
+				}
+				else
+				{
+					++k;
+				}
+			}
+		};
+
+		IROperands ops;
+		for (int32_t i = 0, n = (int32_t)insts.size(); i < n; i++)
+		{
+			IRCommon* ir = insts[i];
+			if (!GetOperands(ir, ops))
+			{
+				// 无法分析的指令可能读写任意变量,保留之前所有的复制
+				copies.clear();
+				continue;
+			}
+			for (int32_t j = 0; j < ops.srcCount; j++)
+			{
+				uint16_t* src = ops.srcs[j];
+				for (CopyInfo& ci : copies)
+				{
+					if (ci.dst == *src)
+					{
+						*src = ci.src;
+						break;
+					}
+				}
+			}
+			if (ir->type == HiOpcodeEnum::LdlocVarVar)
+			{
+				IRLdlocVarVar* move = (IRLdlocVarVar*)ir;
+				if (move->dst == move->src)
+				{
+					insts[i] = nullptr;
+					hasDeleted = true;
+					continue;
+				}
+			}
+			if (ops.dst)
+			{
+				uint16_t dst = *ops.dst;
+				killCopies(dst);
+				if (ir->type == HiOpcodeEnum::LdlocVarVar)
+				{
+					// 只传播到eval stack变量的复制。stloc 留给 ForwardStores 合并到计算指令
+					IRLdlocVarVar* move = (IRLdlocVarVar*)ir;
+					if (IsEvalStackVar(move->dst) && !_addressTaken[move->dst] && !_addressTaken[move->src])
+					{
+						copies.push_back({ i, move->dst, move->src });
+					}
+				}
+			}
+		}
+		for (CopyInfo& ci : copies)
+		{
+			if (ci.dst >= bb->outStackSize)
+			{
+				insts[ci.instIdx] = nullptr;
+				hasDeleted = true;
+			}
+		}
+		if (hasDeleted)
+		{
+			RemoveDeletedInsts(bb);
+		}
+	}
+
+	bool IROptimizer::IsEvalStackVarDeadAfter(IRBasicBlock* bb, int32_t instIdx, uint16_t var) const
+	{
+		IL2CPP_ASSERT(IsEvalStackVar(var));
+		if (_addressTaken[var])
+		{
+			return false;
+		}
+		auto& insts = bb->insts;
+		IROperands ops;
+		for (int32_t i = instIdx + 1, n = (int32_t)insts.size(); i < n; i++)
+		{
+			if (!GetOperands(insts[i], ops))
+			{
+				return false;
+			}
+			for (int32_t j = 0; j < ops.srcCount; j++)
+			{
+				if (*ops.srcs[j] == var)
+				{
+					return false;
+				}
+			}
+			if (ops.dst && *ops.dst == var)
+			{
+				return true;
+			}
+		}
+		return var >= bb->outStackSize;
+	}
+
+	// 计算结果先写到eval stack再 stloc/starg 到变量时,让计算指令直接写入目标变量。
+	// 例如 a = b + c 最终只剩下一条 BinOpVarVarVar_Add_i4 a b c。
+	void IROptimizer::ForwardStores(IRBasicBlock* bb)
+	{
+		auto& insts = bb->insts;
+		bool hasDeleted = false;
+		IROperands ops;
+		int32_t prevIdx = -1;
+		for (int32_t i = 0, n = (int32_t)insts.size(); i < n; i++)
+		{
+			IRCommon* ir = insts[i];
+			if (ir->type == HiOpcodeEnum::LdlocVarVar && prevIdx >= 0)
+			{
+				IRLdlocVarVar* move = (IRLdlocVarVar*)ir;
+				if (IsEvalStackVar(move->src) && GetOperands(insts[prevIdx], ops) && ops.dst && *ops.dst == move->src
+					&& IsEvalStackVarDeadAfter(bb, i, move->src))
+				{
+					*ops.dst = move->dst;
+					insts[i] = nullptr;
+					hasDeleted = true;
+					continue;
+				}
+			}
+			prevIdx = i;
+		}
+		if (hasDeleted)
+		{
+			RemoveDeletedInsts(bb);
+		}
+	}
+
+	void IROptimizer::FuseInstructions()
+	{
+		if (!_addressTaken)
+		{
+			ComputeAddressTakenVars();
+		}
+		for (IRBasicBlock* bb : _irbbs)
+		{
+			auto& insts = bb->insts;
+			if (insts.size() < 2)
+			{
+				continue;
+			}
+			// 合并结果仍可能与下一条指令继续合并,如 ldlen; conv.i4; blt 最终合并为一条 BranchVarArrayLength
+			int32_t last = 0;
+			for (int32_t i = 1, n = (int32_t)insts.size(); i < n; i++)
+			{
+				IRCommon* fused = FuseInstructionPair(bb, insts[last], insts[i], i);
+				if (fused)
+				{
+					insts[last] = fused;
+				}
+				else
+				{
+					insts[++last] = insts[i];
+				}
+			}
+			insts.resize(last + 1);
+		}
+	}
+
+	// first 的结果只被 second 读取时,把相邻的两条指令合并为一条。
+	// 合并的组合取自 Roslyn 对循环条件、数组遍历和字段运算生成的常见指令序列。
+	IRCommon* IROptimizer::FuseInstructionPair(IRBasicBlock* bb, IRCommon* first, IRCommon* second, int32_t secondIdx)
+	{
+		IROperands ops;
+		if (!GetOperands(first, ops) || !ops.dst || !IsEvalStackVar(*ops.dst))
+		{
+			return nullptr;
+		}
+		uint16_t tmp = *ops.dst;
+
+		switch (second->type)
+		{
+		case HiOpcodeEnum::BranchTrueVar_i4:
+		case HiOpcodeEnum::BranchFalseVar_i4:
+		{
+			IRBranchTrueVar_i4* br = (IRBranchTrueVar_i4*)second;
+			HiOpcodeEnum branchOp;
+			if (br->op != tmp || !TryGetCompareBranchOpcode(first->type, second->type == HiOpcodeEnum::BranchTrueVar_i4, branchOp)
+				|| !IsEvalStackVarDeadAfter(bb, secondIdx, tmp))
+			{
+				return nullptr;
+			}
+			IRCompOpVarVarVar_Ceq_i4* cmp = (IRCompOpVarVarVar_Ceq_i4*)first;
+			IRBranchVarVar_Ceq_i4* ir = _pool.AllocIR<IRBranchVarVar_Ceq_i4>();
+			ir->type = branchOp;
+			ir->op1 = cmp->c1;
+			ir->op2 = cmp->c2;
+			ir->offset = br->offset;
+			AddRelocationOffset(&ir->offset);
+			return ir;
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_i4:
+		{
+			// ldlen; conv.i4
+			IRConvertVarVar_i8_i4* conv = (IRConvertVarVar_i8_i4*)second;
+			if (first->type != HiOpcodeEnum::GetArrayLengthVarVar_8 || conv->src != tmp
+				|| (conv->dst != tmp && !IsEvalStackVarDeadAfter(bb, secondIdx, tmp)))
+			{
+				return nullptr;
+			}
+			IRGetArrayLengthVarVar_4* ir = _pool.AllocIR<IRGetArrayLengthVarVar_4>();
+			ir->type = HiOpcodeEnum::GetArrayLengthVarVar_4;
+			ir->len = conv->dst;
+			ir->arr = ((IRGetArrayLengthVarVar_8*)first)->arr;
+			return ir;
+		}
+		case HiOpcodeEnum::BranchVarVar_Clt_i4:
+		case HiOpcodeEnum::BranchVarVar_Cge_i4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+		case HiOpcodeEnum::BranchVarVar_Cle_i4:
+		{
+			// i < arr.Length 或 arr.Length > i
+			IRBranchVarVar_Ceq_i4* br = (IRBranchVarVar_Ceq_i4*)second;
+			if (first->type != HiOpcodeEnum::GetArrayLengthVarVar_4 || br->op1 == br->op2)
+			{
+				return nullptr;
+			}
+			HiOpcodeEnum branchOp;
+			uint16_t index;
+			if (br->op2 == tmp && (second->type == HiOpcodeEnum::BranchVarVar_Clt_i4 || second->type == HiOpcodeEnum::BranchVarVar_Cge_i4))
+			{
+				branchOp = second->type == HiOpcodeEnum::BranchVarVar_Clt_i4 ? HiOpcodeEnum::BranchVarArrayLength_Clt_i4 : HiOpcodeEnum::BranchVarArrayLength_Cge_i4;
+				index = br->op1;
+			}
+			else if (br->op1 == tmp && (second->type == HiOpcodeEnum::BranchVarVar_Cgt_i4 || second->type == HiOpcodeEnum::BranchVarVar_Cle_i4))
+			{
+				branchOp = second->type == HiOpcodeEnum::BranchVarVar_Cgt_i4 ? HiOpcodeEnum::BranchVarArrayLength_Clt_i4 : HiOpcodeEnum::BranchVarArrayLength_Cge_i4;
+				index = br->op2;
+			}
+			else
+			{
+				return nullptr;
+			}
+			if (!IsEvalStackVarDeadAfter(bb, secondIdx, tmp))
+			{
+				return nullptr;
+			}
+			IRBranchVarArrayLength_Clt_i4* ir = _pool.AllocIR<IRBranchVarArrayLength_Clt_i4>();
+			ir->type = branchOp;
+			ir->op = index;
+			ir->arr = ((IRGetArrayLengthVarVar_4*)first)->arr;
+			ir->offset = br->offset;
+			AddRelocationOffset(&ir->offset);
+			return ir;
+		}
+		default:
+		{
+			// ldfld 的结果直接作为算术运算的操作数
+			HiOpcodeEnum fusedOp;
+			if (!TryGetFieldBinOpOpcode(second->type, GetLdfldPrimitiveSize(first->type), fusedOp))
+			{
+				return nullptr;
+			}
+			IRBinOpVarVarVar_Add_i4* bin = (IRBinOpVarVarVar_Add_i4*)second;
+			uint16_t op1;
+			if (bin->op2 == tmp && bin->op1 != tmp)
+			{
+				op1 = bin->op1;
+			}
+			else if (bin->op1 == tmp && bin->op2 != tmp && fusedOp != HiOpcodeEnum::BinOpVarVarFld_Sub_i4 && fusedOp != HiOpcodeEnum::BinOpVarVarFld_Sub_i8
+				&& fusedOp != HiOpcodeEnum::BinOpVarVarFld_Sub_f4 && fusedOp != HiOpcodeEnum::BinOpVarVarFld_Sub_f8)
+			{
+				op1 = bin->op2;
+			}
+			else
+			{
+				return nullptr;
+			}
+			if (!IsEvalStackVarDeadAfter(bb, secondIdx, tmp))
+			{
+				return nullptr;
+			}
+			IRLdfldVarVar_i4* ldfld = (IRLdfldVarVar_i4*)first;
+			IRBinOpVarVarFld_Add_i4* ir = _pool.AllocIR<IRBinOpVarVarFld_Add_i4>();
+			ir->type = fusedOp;
+			ir->ret = bin->ret;
+			ir->op1 = op1;
+			ir->obj = ldfld->obj;
+			ir->offset = ldfld->offset;
+			return ir;
+		}
+		}
+	}
+}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+
+#include "Transform.h"
+#include "TemporaryMemoryArena.h"
+
+namespace huatuo
+{
+namespace transform
+{
+	// 指令读写的StackObject变量。只描述读写恰好一个StackObject的指令，
+	// 其他指令(call、valuetype拷贝等)视为可能读写任意变量。
+	struct IROperands
+	{
+		uint16_t* dst;
+		uint16_t* srcs[3];
+		int32_t srcCount;
+	};
+
+	class IROptimizer
+	{
+	public:
+		IROptimizer(TemporaryMemoryArena& pool, std::vector<IRBasicBlock*>& irbbs, ArenaVector<int32_t*>& relocationOffsets, int32_t evalStackBaseOffset, int32_t maxStackSize)
+			: _pool(pool), _irbbs(irbbs), _relocationOffsets(relocationOffsets), _evalStackBaseOffset(evalStackBaseOffset), _maxStackSize(maxStackSize), _addressTaken(nullptr)
+		{
+
+		}
+
+		static bool GetOperands(interpreter::IRCommon* ir, IROperands& ops);
+
+		void PropagateCopies();
+
+		// 合并相邻的常见指令组合(比较+跳转、ldlen+conv+跳转、ldfld+算术),减少指令分发次数
+		void FuseInstructions();
+
+	private:
+
+		struct CopyInfo
+		{
+			int32_t instIdx;
+			uint16_t dst;
+			uint16_t src;
+		};
+
+		bool IsEvalStackVar(uint16_t var) const { return var >= _evalStackBaseOffset; }
+
+		void ComputeAddressTakenVars();
+		void ForwardCopies(IRBasicBlock* bb);
+		void ForwardStores(IRBasicBlock* bb);
+		bool IsEvalStackVarDeadAfter(IRBasicBlock* bb, int32_t instIdx, uint16_t var) const;
+		static void RemoveDeletedInsts(IRBasicBlock* bb);
+		interpreter::IRCommon* FuseInstructionPair(IRBasicBlock* bb, interpreter::IRCommon* first, interpreter::IRCommon* second, int32_t secondIdx);
+		// 被合并的旧指令仍在arena中,其跳转偏移照常重定位但不再被使用
+		void AddRelocationOffset(int32_t* offsetPtr) { _relocationOffsets.push_back(offsetPtr); }
+
+		TemporaryMemoryArena& _pool;
+		std::vector<IRBasicBlock*>& _irbbs;
+		ArenaVector<int32_t*>& _relocationOffsets;
+		const int32_t _evalStackBaseOffset;
+		const int32_t _maxStackSize;
+		bool* _addressTaken;
+	};
+}
+}
@@ -0,0 +1,805 @@
+#include "Intrinsics.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "utils/StringUtils.h"
+#include "vm/Class.h"
+
+#include "../metadata/MetadataUtil.h"
+#include "../interpreter/InstrinctDef.h"
+#include "../interpreter/LockFreeHashMap.h"
+
+using namespace huatuo::metadata;
+using namespace huatuo::interpreter;
+
+namespace huatuo
+{
+namespace transform
+{
+
+	enum class IntrinsicNumberType
+	{
+		I4,
+		I8,
+		R4,
+		R8,
+		None,
+	};
+
+	static IntrinsicNumberType GetIntrinsicNumberType(const Il2CppType* type)
+	{
+		if (type->byref)
+		{
+			return IntrinsicNumberType::None;
+		}
+		switch (type->type)
+		{
+		case IL2CPP_TYPE_I4: return IntrinsicNumberType::I4;
+		case IL2CPP_TYPE_I8: return IntrinsicNumberType::I8;
+		case IL2CPP_TYPE_R4: return IntrinsicNumberType::R4;
+		case IL2CPP_TYPE_R8: return IntrinsicNumberType::R8;
+		default: return IntrinsicNumberType::None;
+		}
+	}
+
+	// 所有参数类型相同时返回该类型
+	static IntrinsicNumberType GetIntrinsicParamNumberType(const MethodInfo* method)
+	{
+		if (method->parameters_count == 0)
+		{
+			return IntrinsicNumberType::None;
+		}
+		IntrinsicNumberType type = GetIntrinsicNumberType(method->parameters[0].parameter_type);
+		for (uint8_t i = 1; i < method->parameters_count; i++)
+		{
+			if (GetIntrinsicNumberType(method->parameters[i].parameter_type) != type)
+			{
+				return IntrinsicNumberType::None;
+			}
+		}
+		return type;
+	}
+
+	template<typename T>
+	static T* AddIntrinsicIR(IntrinsicCallSite& callSite, HiOpcodeEnum opcode)
+	{
+		T* ir = callSite.pool.AllocIR<T>();
+		ir->type = opcode;
+		callSite.insts.push_back(ir);
+		return ir;
+	}
+
+	// opcodes按IntrinsicNumberType顺序排列,HiOpcodeEnum::__Count表示不支持
+	template<typename T>
+	static bool LowerUnaryOp(IntrinsicCallSite& callSite, const HiOpcodeEnum (&opcodes)[4])
+	{
+		IntrinsicNumberType type = GetIntrinsicParamNumberType(callSite.method);
+		if (type == IntrinsicNumberType::None || opcodes[(int)type] == HiOpcodeEnum::__Count)
+		{
+			return false;
+		}
+		T* ir = AddIntrinsicIR<T>(callSite, opcodes[(int)type]);
+		ir->dst = callSite.retOffset;
+		ir->src = callSite.args[0].locOffset;
+		return true;
+	}
+
+	template<typename T>
+	static bool LowerBinOp(IntrinsicCallSite& callSite, const HiOpcodeEnum (&opcodes)[4])
+	{
+		IntrinsicNumberType type = GetIntrinsicParamNumberType(callSite.method);
+		if (type == IntrinsicNumberType::None)
+		{
+			return false;
+		}
+		T* ir = AddIntrinsicIR<T>(callSite, opcodes[(int)type]);
+		ir->ret = callSite.retOffset;
+		ir->op1 = callSite.args[0].locOffset;
+		ir->op2 = callSite.args[1].locOffset;
+		return true;
+	}
+
+	static bool LowerMathAbs(IntrinsicCallSite& callSite)
+	{
+		static const HiOpcodeEnum opcodes[] = { HiOpcodeEnum::MathAbsVarVar_i4, HiOpcodeEnum::MathAbsVarVar_i8, HiOpcodeEnum::MathAbsVarVar_f4, HiOpcodeEnum::MathAbsVarVar_f8 };
+		return LowerUnaryOp<IRMathAbsVarVar_i4>(callSite, opcodes);
+	}
+
+	static bool LowerMathSqrt(IntrinsicCallSite& callSite)
+	{
+		static const HiOpcodeEnum opcodes[] = { HiOpcodeEnum::__Count, HiOpcodeEnum::__Count, HiOpcodeEnum::MathSqrtVarVar_f4, HiOpcodeEnum::MathSqrtVarVar_f8 };
+		return LowerUnaryOp<IRMathSqrtVarVar_f4>(callSite, opcodes);
+	}
+
+	static bool LowerMathFloor(IntrinsicCallSite& callSite)
+	{
+		static const HiOpcodeEnum opcodes[] = { HiOpcodeEnum::__Count, HiOpcodeEnum::__Count, HiOpcodeEnum::MathFloorVarVar_f4, HiOpcodeEnum::MathFloorVarVar_f8 };
+		return LowerUnaryOp<IRMathFloorVarVar_f4>(callSite, opcodes);
+	}
+
+	static bool LowerMathMin(IntrinsicCallSite& callSite)
+	{
+		static const HiOpcodeEnum opcodes[] = { HiOpcodeEnum::MathMinVarVarVar_i4, HiOpcodeEnum::MathMinVarVarVar_i8, HiOpcodeEnum::MathMinVarVarVar_f4, HiOpcodeEnum::MathMinVarVarVar_f8 };
+		return LowerBinOp<IRMathMinVarVarVar_i4>(callSite, opcodes);
+	}
+
+	static bool LowerMathMax(IntrinsicCallSite& callSite)
+	{
+		static const HiOpcodeEnum opcodes[] = { HiOpcodeEnum::MathMaxVarVarVar_i4, HiOpcodeEnum::MathMaxVarVarVar_i8, HiOpcodeEnum::MathMaxVarVarVar_f4, HiOpcodeEnum::MathMaxVarVarVar_f8 };
+		return LowerBinOp<IRMathMaxVarVarVar_i4>(callSite, opcodes);
+	}
+
+	static bool LowerMathClamp(IntrinsicCallSite& callSite)
+	{
+		static const HiOpcodeEnum opcodes[] = { HiOpcodeEnum::MathClampVarVarVarVar_i4, HiOpcodeEnum::MathClampVarVarVarVar_i8, HiOpcodeEnum::MathClampVarVarVarVar_f4, HiOpcodeEnum::MathClampVarVarVarVar_f8 };
+		IntrinsicNumberType type = GetIntrinsicParamNumberType(callSite.method);
+		if (type == IntrinsicNumberType::None)
+		{
+			return false;
+		}
+		IRMathClampVarVarVarVar_i4* ir = AddIntrinsicIR<IRMathClampVarVarVarVar_i4>(callSite, opcodes[(int)type]);
+		ir->ret = callSite.retOffset;
+		ir->value = callSite.args[0].locOffset;
+		ir->min = callSite.args[1].locOffset;
+		ir->max = callSite.args[2].locOffset;
+		return true;
+	}
+
+	static bool LowerArrayGetLength(IntrinsicCallSite& callSite)
+	{
+		IRArrayGetLengthVarVar* ir = AddIntrinsicIR<IRArrayGetLengthVarVar>(callSite, HiOpcodeEnum::ArrayGetLengthVarVar);
+		ir->len = callSite.retOffset;
+		ir->arr = callSite.args[0].locOffset;
+		return true;
+	}
+
+	static bool LowerStringGetLength(IntrinsicCallSite& callSite)
+	{
+		IRStringGetLengthVarVar* ir = AddIntrinsicIR<IRStringGetLengthVarVar>(callSite, HiOpcodeEnum::StringGetLengthVarVar);
+		ir->len = callSite.retOffset;
+		ir->str = callSite.args[0].locOffset;
+		return true;
+	}
+
+	static bool LowerStringGetChars(IntrinsicCallSite& callSite)
+	{
+		IRStringGetCharsVarVarVar* ir = AddIntrinsicIR<IRStringGetCharsVarVarVar>(callSite, HiOpcodeEnum::StringGetCharsVarVarVar);
+		ir->ret = callSite.retOffset;
+		ir->str = callSite.args[0].locOffset;
+		ir->index = callSite.args[1].locOffset;
+		return true;
+	}
+
+	static bool LowerObjectCtor(IntrinsicCallSite& callSite)
+	{
+		// System.Object的构造函数什么也不做
+		return true;
+	}
+
+	static bool LowerNullableCtor(IntrinsicCallSite& callSite)
+	{
+		if (callSite.method->parameters_count != 1)
+		{
+			return false;
+		}
+		IRNullableCtorVarVar* ir = AddIntrinsicIR<IRNullableCtorVarVar>(callSite, HiOpcodeEnum::NullableCtorVarVar);
+		ir->dst = callSite.args[0].locOffset;
+		ir->data = callSite.args[1].locOffset;
+		ir->size = GetTypeValueSize(callSite.method->klass->castClass);
+		return true;
+	}
+
+	static bool LowerNullableGetValueOrDefault(IntrinsicCallSite& callSite)
+	{
+		uint32_t eleSize = GetTypeValueSize(callSite.method->klass->castClass);
+		if (callSite.method->parameters_count == 0)
+		{
+			IRNullableGetValueOrDefaultVarVar* ir = AddIntrinsicIR<IRNullableGetValueOrDefaultVarVar>(callSite, HiOpcodeEnum::NullableGetValueOrDefaultVarVar);
+			ir->dst = callSite.retOffset;
+			ir->obj = callSite.args[0].locOffset;
+			ir->size = eleSize;
+			return true;
+		}
+		if (callSite.method->parameters_count == 1)
+		{
+			IRNullableGetValueOrDefaultVarVar_1* ir = AddIntrinsicIR<IRNullableGetValueOrDefaultVarVar_1>(callSite, HiOpcodeEnum::NullableGetValueOrDefaultVarVar_1);
+			ir->dst = callSite.retOffset;
+			ir->obj = callSite.args[0].locOffset;
+			ir->defaultValue = callSite.args[1].locOffset;
+			ir->size = eleSize;
+			return true;
+		}
+		return false;
+	}
+
+	static bool LowerNullableGetHasValue(IntrinsicCallSite& callSite)
+	{
+		IRNullableHasValueVar* ir = AddIntrinsicIR<IRNullableHasValueVar>(callSite, HiOpcodeEnum::NullableHasValueVar);
+		ir->result = callSite.retOffset;
+		ir->obj = callSite.args[0].locOffset;
+		ir->offset = GetTypeValueSize(callSite.method->klass->castClass);
+		return true;
+	}
+
+	static bool LowerNullableGetValue(IntrinsicCallSite& callSite)
+	{
+		IRNullableGetValueVarVar* ir = AddIntrinsicIR<IRNullableGetValueVarVar>(callSite, HiOpcodeEnum::NullableGetValueVarVar);
+		ir->dst = callSite.retOffset;
+		ir->obj = callSite.args[0].locOffset;
+		ir->size = GetTypeValueSize(callSite.method->klass->castClass);
+		return true;
+	}
+
+	// 值类型按大小选择i4/i8版本,引用类型用pointer版本
+	static HiOpcodeEnum SelectInterlockedOpcode(const MethodInfo* method, HiOpcodeEnum opI4, HiOpcodeEnum opI8, HiOpcodeEnum opPointer)
+	{
+		const Il2CppType* paramType = method->parameters[1].parameter_type;
+		if (paramType->byref)
+		{
+			return opPointer;
+		}
+		Il2CppClass* paramKlass = il2cpp::vm::Class::FromIl2CppType(paramType);
+		if (!paramKlass->valuetype)
+		{
+			return opPointer;
+		}
+		switch (GetTypeValueSize(paramKlass))
+		{
+		case 4: return opI4;
+		case 8: return opI8;
+		default: return HiOpcodeEnum::__Count;
+		}
+	}
+
+	static bool LowerInterlockedCompareExchange(IntrinsicCallSite& callSite)
+	{
+		// 只替换没有AOT实现的泛型实例
+		if (callSite.method->methodPointer || callSite.method->parameters_count != 3)
+		{
+			return false;
+		}
+		HiOpcodeEnum opcode = SelectInterlockedOpcode(callSite.method, HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i4,
+			HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i8, HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_pointer);
+		if (opcode == HiOpcodeEnum::__Count)
+		{
+			RaiseExecuteEngineException("not support System.Threading.Interlocked.CompareExchange");
+		}
+		IRInterlockedCompareExchangeVarVarVarVar_pointer* ir = AddIntrinsicIR<IRInterlockedCompareExchangeVarVarVarVar_pointer>(callSite, opcode);
+		ir->ret = callSite.retOffset;
+		ir->localtion = callSite.args[0].locOffset;
+		ir->value = callSite.args[1].locOffset;
+		ir->comparand = callSite.args[2].locOffset;
+		return true;
+	}
+
+	static bool LowerInterlockedExchange(IntrinsicCallSite& callSite)
+	{
+		if (callSite.method->methodPointer || callSite.method->parameters_count != 2)
+		{
+			return false;
+		}
+		HiOpcodeEnum opcode = SelectInterlockedOpcode(callSite.method, HiOpcodeEnum::InterlockedExchangeVarVarVar_i4,
+			HiOpcodeEnum::InterlockedExchangeVarVarVar_i8, HiOpcodeEnum::InterlockedExchangeVarVarVar_pointer);
+		if (opcode == HiOpcodeEnum::__Count)
+		{
+			RaiseExecuteEngineException("not support System.Threading.Interlocked.Exchange");
+		}
+		IRInterlockedExchangeVarVarVar_pointer* ir = AddIntrinsicIR<IRInterlockedExchangeVarVarVar_pointer>(callSite, opcode);
+		ir->ret = callSite.retOffset;
+		ir->localtion = callSite.args[0].locOffset;
+		ir->value = callSite.args[1].locOffset;
+		return true;
+	}
+
+	static bool LowerVector2Ctor(IntrinsicCallSite& callSite)
+	{
+		if (callSite.method->parameters_count != 2)
+		{
+			return false;
+		}
+		IRNewVector2VarVarVar* ir = AddIntrinsicIR<IRNewVector2VarVarVar>(callSite, HiOpcodeEnum::NewVector2VarVarVar);
+		ir->obj = callSite.args[0].locOffset;
+		ir->x = callSite.args[1].locOffset;
+		ir->y = callSite.args[2].locOffset;
+		return true;
+	}
+
+	static bool LowerVector3Ctor(IntrinsicCallSite& callSite)
+	{
+		if (callSite.method->parameters_count != 3)
+		{
+			return false;
+		}
+		IRNewVector3VarVarVarVar* ir = AddIntrinsicIR<IRNewVector3VarVarVarVar>(callSite, HiOpcodeEnum::NewVector3VarVarVarVar);
+		ir->obj = callSite.args[0].locOffset;
+		ir->x = callSite.args[1].locOffset;
+		ir->y = callSite.args[2].locOffset;
+		ir->z = callSite.args[3].locOffset;
+		return true;
+	}
+
+	static bool LowerVector4Ctor(IntrinsicCallSite& callSite)
+	{
+		if (callSite.method->parameters_count != 4)
+		{
+			return false;
+		}
+		IRNewVector4VarVarVarVarVar* ir = AddIntrinsicIR<IRNewVector4VarVarVarVarVar>(callSite, HiOpcodeEnum::NewVector4VarVarVarVarVar);
+		ir->obj = callSite.args[0].locOffset;
+		ir->x = callSite.args[1].locOffset;
+		ir->y = callSite.args[2].locOffset;
+		ir->z = callSite.args[3].locOffset;
+		ir->w = callSite.args[4].locOffset;
+		return true;
+	}
+
+	static bool IsFloatParam(const MethodInfo* method, uint8_t index)
+	{
+		const Il2CppType* type = method->parameters[index].parameter_type;
+		return !type->byref && type->type == IL2CPP_TYPE_R4;
+	}
+
+	static bool IsDeclaringTypeParam(const MethodInfo* method, uint8_t index)
+	{
+		const Il2CppType* type = method->parameters[index].parameter_type;
+		return !type->byref && type->type == IL2CPP_TYPE_VALUETYPE && il2cpp::vm::Class::FromIl2CppType(type) == method->klass;
+	}
+
+	static bool IsStaticMethod(const MethodInfo* method)
+	{
+		return method->flags & METHOD_ATTRIBUTE_STATIC;
+	}
+
+	// 无参数的实例函数(属性),this为值类型的指针
+	static bool IsInstanceGetter(const MethodInfo* method)
+	{
+		return !IsStaticMethod(method) && method->parameters_count == 0;
+	}
+
+	static bool IsStaticBinOp(const MethodInfo* method)
+	{
+		return IsStaticMethod(method) && method->parameters_count == 2 && IsDeclaringTypeParam(method, 0) && IsDeclaringTypeParam(method, 1);
+	}
+
+	struct VectorIntrinsicOpcodes
+	{
+		int32_t valueSize;
+		HiOpcodeEnum add;
+		HiOpcodeEnum sub;
+		HiOpcodeEnum neg;
+		HiOpcodeEnum mulScalar;
+		HiOpcodeEnum divScalar;
+		HiOpcodeEnum dot;
+		HiOpcodeEnum magnitude;
+		HiOpcodeEnum sqrMagnitude;
+		HiOpcodeEnum normalized;
+		HiOpcodeEnum normalize;
+	};
+
+	// 按分量个数排列,从Vector2开始
+	static const VectorIntrinsicOpcodes s_vectorOpcodes[] =
+	{
+		{
+			sizeof(HtVector2),
+			HiOpcodeEnum::Vector2AddVarVarVar, HiOpcodeEnum::Vector2SubVarVarVar, HiOpcodeEnum::Vector2NegVarVar,
+			HiOpcodeEnum::Vector2MulScalarVarVarVar, HiOpcodeEnum::Vector2DivScalarVarVarVar, HiOpcodeEnum::Vector2DotVarVarVar,
+			HiOpcodeEnum::Vector2MagnitudeVarVar, HiOpcodeEnum::Vector2SqrMagnitudeVarVar, HiOpcodeEnum::Vector2NormalizedVarVar, HiOpcodeEnum::Vector2NormalizeVar,
+		},
+		{
+			sizeof(HtVector3),
+			HiOpcodeEnum::Vector3AddVarVarVar, HiOpcodeEnum::Vector3SubVarVarVar, HiOpcodeEnum::Vector3NegVarVar,
+			HiOpcodeEnum::Vector3MulScalarVarVarVar, HiOpcodeEnum::Vector3DivScalarVarVarVar, HiOpcodeEnum::Vector3DotVarVarVar,
+			HiOpcodeEnum::Vector3MagnitudeVarVar, HiOpcodeEnum::Vector3SqrMagnitudeVarVar, HiOpcodeEnum::Vector3NormalizedVarVar, HiOpcodeEnum::Vector3NormalizeVar,
+		},
+		{
+			sizeof(HtVector4),
+			HiOpcodeEnum::Vector4AddVarVarVar, HiOpcodeEnum::Vector4SubVarVarVar, HiOpcodeEnum::Vector4NegVarVar,
+			HiOpcodeEnum::Vector4MulScalarVarVarVar, HiOpcodeEnum::Vector4DivScalarVarVarVar, HiOpcodeEnum::Vector4DotVarVarVar,
+			HiOpcodeEnum::Vector4MagnitudeVarVar, HiOpcodeEnum::Vector4SqrMagnitudeVarVar, HiOpcodeEnum::Vector4NormalizedVarVar, HiOpcodeEnum::Vector4NormalizeVar,
+		},
+	};
+
+	// 同名类型的布局可能不同(如其他插件中的Vector3),大小不一致时不替换
+	template<int32_t N>
+	static const VectorIntrinsicOpcodes* GetVectorOpcodes(const MethodInfo* method)
+	{
+		const VectorIntrinsicOpcodes& opcodes = s_vectorOpcodes[N - 2];
+		return GetTypeValueSize(method->klass) == opcodes.valueSize ? &opcodes : nullptr;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorAdd(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsStaticBinOp(callSite.method))
+		{
+			return false;
+		}
+		IRVector3AddVarVarVar* ir = AddIntrinsicIR<IRVector3AddVarVarVar>(callSite, opcodes->add);
+		ir->ret = callSite.retOffset;
+		ir->op1 = callSite.args[0].locOffset;
+		ir->op2 = callSite.args[1].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorSub(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsStaticBinOp(callSite.method))
+		{
+			return false;
+		}
+		IRVector3SubVarVarVar* ir = AddIntrinsicIR<IRVector3SubVarVarVar>(callSite, opcodes->sub);
+		ir->ret = callSite.retOffset;
+		ir->op1 = callSite.args[0].locOffset;
+		ir->op2 = callSite.args[1].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorNeg(IntrinsicCallSite& callSite)
+	{
+		const MethodInfo* method = callSite.method;
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(method);
+		if (!opcodes || !IsStaticMethod(method) || method->parameters_count != 1 || !IsDeclaringTypeParam(method, 0))
+		{
+			return false;
+		}
+		IRVector3NegVarVar* ir = AddIntrinsicIR<IRVector3NegVarVar>(callSite, opcodes->neg);
+		ir->dst = callSite.retOffset;
+		ir->src = callSite.args[0].locOffset;
+		return true;
+	}
+
+	// op_Multiply(vector, float) 与 op_Multiply(float, vector)
+	template<int32_t N>
+	static bool LowerVectorMul(IntrinsicCallSite& callSite)
+	{
+		const MethodInfo* method = callSite.method;
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(method);
+		if (!opcodes || !IsStaticMethod(method) || method->parameters_count != 2)
+		{
+			return false;
+		}
+		int32_t vecIndex;
+		if (IsDeclaringTypeParam(method, 0) && IsFloatParam(method, 1))
+		{
+			vecIndex = 0;
+		}
+		else if (IsFloatParam(method, 0) && IsDeclaringTypeParam(method, 1))
+		{
+			vecIndex = 1;
+		}
+		else
+		{
+			return false;
+		}
+		IRVector3MulScalarVarVarVar* ir = AddIntrinsicIR<IRVector3MulScalarVarVarVar>(callSite, opcodes->mulScalar);
+		ir->ret = callSite.retOffset;
+		ir->vec = callSite.args[vecIndex].locOffset;
+		ir->scalar = callSite.args[1 - vecIndex].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorDiv(IntrinsicCallSite& callSite)
+	{
+		const MethodInfo* method = callSite.method;
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(method);
+		if (!opcodes || !IsStaticMethod(method) || method->parameters_count != 2 || !IsDeclaringTypeParam(method, 0) || !IsFloatParam(method, 1))
+		{
+			return false;
+		}
+		IRVector3DivScalarVarVarVar* ir = AddIntrinsicIR<IRVector3DivScalarVarVarVar>(callSite, opcodes->divScalar);
+		ir->ret = callSite.retOffset;
+		ir->vec = callSite.args[0].locOffset;
+		ir->scalar = callSite.args[1].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorDot(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsStaticBinOp(callSite.method))
+		{
+			return false;
+		}
+		IRVector3DotVarVarVar* ir = AddIntrinsicIR<IRVector3DotVarVarVar>(callSite, opcodes->dot);
+		ir->ret = callSite.retOffset;
+		ir->op1 = callSite.args[0].locOffset;
+		ir->op2 = callSite.args[1].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorGetMagnitude(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsInstanceGetter(callSite.method))
+		{
+			return false;
+		}
+		IRVector3MagnitudeVarVar* ir = AddIntrinsicIR<IRVector3MagnitudeVarVar>(callSite, opcodes->magnitude);
+		ir->ret = callSite.retOffset;
+		ir->self = callSite.args[0].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorGetSqrMagnitude(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsInstanceGetter(callSite.method))
+		{
+			return false;
+		}
+		IRVector3SqrMagnitudeVarVar* ir = AddIntrinsicIR<IRVector3SqrMagnitudeVarVar>(callSite, opcodes->sqrMagnitude);
+		ir->ret = callSite.retOffset;
+		ir->self = callSite.args[0].locOffset;
+		return true;
+	}
+
+	template<int32_t N>
+	static bool LowerVectorGetNormalized(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsInstanceGetter(callSite.method))
+		{
+			return false;
+		}
+		IRVector3NormalizedVarVar* ir = AddIntrinsicIR<IRVector3NormalizedVarVar>(callSite, opcodes->normalized);
+		ir->ret = callSite.retOffset;
+		ir->self = callSite.args[0].locOffset;
+		return true;
+	}
+
+	// 只替换实例函数Normalize(),静态的Normalize(value)与normalized结果相同但参数是值
+	template<int32_t N>
+	static bool LowerVectorNormalize(IntrinsicCallSite& callSite)
+	{
+		const VectorIntrinsicOpcodes* opcodes = GetVectorOpcodes<N>(callSite.method);
+		if (!opcodes || !IsInstanceGetter(callSite.method))
+		{
+			return false;
+		}
+		IRVector3NormalizeVar* ir = AddIntrinsicIR<IRVector3NormalizeVar>(callSite, opcodes->normalize);
+		ir->self = callSite.args[0].locOffset;
+		return true;
+	}
+
+	static bool LowerVector3Cross(IntrinsicCallSite& callSite)
+	{
+		if (!GetVectorOpcodes<3>(callSite.method) || !IsStaticBinOp(callSite.method))
+		{
+			return false;
+		}
+		IRVector3CrossVarVarVar* ir = AddIntrinsicIR<IRVector3CrossVarVarVar>(callSite, HiOpcodeEnum::Vector3CrossVarVarVar);
+		ir->ret = callSite.retOffset;
+		ir->op1 = callSite.args[0].locOffset;
+		ir->op2 = callSite.args[1].locOffset;
+		return true;
+	}
+
+	static bool IsQuaternionType(const MethodInfo* method)
+	{
+		return GetTypeValueSize(method->klass) == sizeof(HtQuaternion);
+	}
+
+	static bool LowerQuaternionCtor(IntrinsicCallSite& callSite)
+	{
+		// 布局与Vector4相同
+		return IsQuaternionType(callSite.method) && LowerVector4Ctor(callSite);
+	}
+
+	// op_Multiply(Quaternion, Quaternion) 与 op_Multiply(Quaternion, Vector3)
+	static bool LowerQuaternionMul(IntrinsicCallSite& callSite)
+	{
+		const MethodInfo* method = callSite.method;
+		if (!IsQuaternionType(method) || !IsStaticMethod(method) || method->parameters_count != 2 || !IsDeclaringTypeParam(method, 0))
+		{
+			return false;
+		}
+		if (IsDeclaringTypeParam(method, 1))
+		{
+			IRQuaternionMulVarVarVar* ir = AddIntrinsicIR<IRQuaternionMulVarVarVar>(callSite, HiOpcodeEnum::QuaternionMulVarVarVar);
+			ir->ret = callSite.retOffset;
+			ir->op1 = callSite.args[0].locOffset;
+			ir->op2 = callSite.args[1].locOffset;
+			return true;
+		}
+		const Il2CppType* pointType = method->parameters[1].parameter_type;
+		if (pointType->byref || pointType->type != IL2CPP_TYPE_VALUETYPE)
+		{
+			return false;
+		}
+		Il2CppClass* pointClass = il2cpp::vm::Class::FromIl2CppType(pointType);
+		if (std::strcmp(pointClass->name, "Vector3") || std::strcmp(pointClass->namespaze, "UnityEngine") || GetTypeValueSize(pointClass) != sizeof(HtVector3))
+		{
+			return false;
+		}
+		IRQuaternionMulVector3VarVarVar* ir = AddIntrinsicIR<IRQuaternionMulVector3VarVarVar>(callSite, HiOpcodeEnum::QuaternionMulVector3VarVarVar);
+		ir->ret = callSite.retOffset;
+		ir->rotation = callSite.args[0].locOffset;
+		ir->point = callSite.args[1].locOffset;
+		return true;
+	}
+
+	static bool LowerQuaternionDot(IntrinsicCallSite& callSite)
+	{
+		if (!IsQuaternionType(callSite.method) || !IsStaticBinOp(callSite.method))
+		{
+			return false;
+		}
+		IRQuaternionDotVarVarVar* ir = AddIntrinsicIR<IRQuaternionDotVarVarVar>(callSite, HiOpcodeEnum::QuaternionDotVarVarVar);
+		ir->ret = callSite.retOffset;
+		ir->op1 = callSite.args[0].locOffset;
+		ir->op2 = callSite.args[1].locOffset;
+		return true;
+	}
+
+	struct IntrinsicKey
+	{
+		const char* namespaze;
+		const char* klassName;
+		const char* methodName;
+	};
+
+	struct IntrinsicKeyHash
+	{
+		size_t operator()(const IntrinsicKey& key) const
+		{
+			size_t hash = il2cpp::utils::StringUtils::Hash(key.methodName);
+			hash = hash * 31 + il2cpp::utils::StringUtils::Hash(key.klassName);
+			return hash * 31 + il2cpp::utils::StringUtils::Hash(key.namespaze);
+		}
+	};
+
+	struct IntrinsicKeyEqual
+	{
+		bool operator()(const IntrinsicKey& a, const IntrinsicKey& b) const
+		{
+			return std::strcmp(a.methodName, b.methodName) == 0 && std::strcmp(a.klassName, b.klassName) == 0 && std::strcmp(a.namespaze, b.namespaze) == 0;
+		}
+	};
+
+	typedef std::unordered_map<IntrinsicKey, IntrinsicLowering, IntrinsicKeyHash, IntrinsicKeyEqual> IntrinsicMap;
+
+	// 注册表发布后不再修改,Register时复制一份加入新项再原子替换。Find无锁读取,旧表不释放。
+	static IntrinsicMap* s_intrinsics;
+
+	struct MethodPointerHash
+	{
+		uint32_t operator()(const MethodInfo* method) const
+		{
+			uint64_t hash = (uint64_t)(uintptr_t)method;
+			return (uint32_t)(hash ^ (hash >> 29));
+		}
+	};
+
+	struct MethodPointerEqual
+	{
+		bool operator()(const MethodInfo* a, const MethodInfo* b) const
+		{
+			return a == b;
+		}
+	};
+
+	// MethodInfo* -> lowering(包括没有lowering的结果)的缓存,同一函数只按名字查一次注册表。注册表变化时清空。
+	static LockFreeHashMap<const MethodInfo*, IntrinsicLowering, MethodPointerHash, MethodPointerEqual> s_methodCache(1024);
+	static baselib::ReentrantLock s_lock;
+
+	static void AddIntrinsic(IntrinsicMap& map, const char* namespaze, const char* klassName, const char* methodName, IntrinsicLowering lowering)
+	{
+		IntrinsicKey key = { namespaze, klassName, methodName };
+		auto it = map.find(key);
+		if (it != map.end())
+		{
+			it->second = lowering;
+			return;
+		}
+		key = { il2cpp::utils::StringUtils::StringDuplicate(namespaze), il2cpp::utils::StringUtils::StringDuplicate(klassName), il2cpp::utils::StringUtils::StringDuplicate(methodName) };
+		map.insert({ key, lowering });
+	}
+
+
+	template<int32_t N>
+	static void AddVectorIntrinsics(IntrinsicMap& map, const char* klassName)
+	{
+		AddIntrinsic(map, "UnityEngine", klassName, "op_Addition", LowerVectorAdd<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "op_Subtraction", LowerVectorSub<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "op_UnaryNegation", LowerVectorNeg<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "op_Multiply", LowerVectorMul<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "op_Division", LowerVectorDiv<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "Dot", LowerVectorDot<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "get_magnitude", LowerVectorGetMagnitude<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "get_sqrMagnitude", LowerVectorGetSqrMagnitude<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "get_normalized", LowerVectorGetNormalized<N>);
+		AddIntrinsic(map, "UnityEngine", klassName, "Normalize", LowerVectorNormalize<N>);
+	}
+
+	void Intrinsics::Initialize()
+	{
+		IntrinsicMap& map = *new IntrinsicMap();
+		AddIntrinsic(map, "System", "Object", ".ctor", LowerObjectCtor);
+		AddIntrinsic(map, "System", "Nullable`1", ".ctor", LowerNullableCtor);
+		AddIntrinsic(map, "System", "Nullable`1", "GetValueOrDefault", LowerNullableGetValueOrDefault);
+		AddIntrinsic(map, "System", "Nullable`1", "get_HasValue", LowerNullableGetHasValue);
+		AddIntrinsic(map, "System", "Nullable`1", "get_Value", LowerNullableGetValue);
+		AddIntrinsic(map, "System.Threading", "Interlocked", "CompareExchange", LowerInterlockedCompareExchange);
+		AddIntrinsic(map, "System.Threading", "Interlocked", "Exchange", LowerInterlockedExchange);
+		AddIntrinsic(map, "UnityEngine", "Vector2", ".ctor", LowerVector2Ctor);
+		AddIntrinsic(map, "UnityEngine", "Vector3", ".ctor", LowerVector3Ctor);
+		AddIntrinsic(map, "UnityEngine", "Vector4", ".ctor", LowerVector4Ctor);
+		AddIntrinsic(map, "UnityEngine", "Quaternion", ".ctor", LowerQuaternionCtor);
+		AddVectorIntrinsics<2>(map, "Vector2");
+		AddVectorIntrinsics<3>(map, "Vector3");
+		AddVectorIntrinsics<4>(map, "Vector4");
+		AddIntrinsic(map, "UnityEngine", "Vector3", "Cross", LowerVector3Cross);
+		AddIntrinsic(map, "UnityEngine", "Quaternion", "op_Multiply", LowerQuaternionMul);
+		AddIntrinsic(map, "UnityEngine", "Quaternion", "Dot", LowerQuaternionDot);
+
+		AddIntrinsic(map, "System", "Math", "Abs", LowerMathAbs);
+		AddIntrinsic(map, "System", "Math", "Min", LowerMathMin);
+		AddIntrinsic(map, "System", "Math", "Max", LowerMathMax);
+		AddIntrinsic(map, "System", "Math", "Sqrt", LowerMathSqrt);
+		AddIntrinsic(map, "System", "Math", "Floor", LowerMathFloor);
+		AddIntrinsic(map, "System", "Math", "Clamp", LowerMathClamp);
+		AddIntrinsic(map, "System", "MathF", "Abs", LowerMathAbs);
+		AddIntrinsic(map, "System", "MathF", "Min", LowerMathMin);
+		AddIntrinsic(map, "System", "MathF", "Max", LowerMathMax);
+		AddIntrinsic(map, "System", "MathF", "Sqrt", LowerMathSqrt);
+		AddIntrinsic(map, "System", "MathF", "Floor", LowerMathFloor);
+		AddIntrinsic(map, "System", "Array", "get_Length", LowerArrayGetLength);
+		AddIntrinsic(map, "System", "String", "get_Length", LowerStringGetLength);
+		AddIntrinsic(map, "System", "String", "get_Chars", LowerStringGetChars);
+		il2cpp::os::FastAutoLock lock(&s_lock);
+		il2cpp::os::Atomic::ExchangePointer(&s_intrinsics, &map);
+		s_methodCache.Clear();
+	}
+
+	void Intrinsics::Register(const char* namespaze, const char* klassName, const char* methodName, IntrinsicLowering lowering)
+	{
+		il2cpp::os::FastAutoLock lock(&s_lock);
+		IntrinsicMap* map = s_intrinsics ? new IntrinsicMap(*s_intrinsics) : new IntrinsicMap();
+		AddIntrinsic(*map, namespaze, klassName, methodName, lowering);
+		il2cpp::os::Atomic::ExchangePointer(&s_intrinsics, map);
+		s_methodCache.Clear();
+	}
+
+	IntrinsicLowering Intrinsics::Find(const MethodInfo* method)
+	{
+		Il2CppClass* klass = method->klass;
+		if (metadata::IsInterpreterType(klass))
+		{
+			return nullptr;
+		}
+		IntrinsicLowering lowering;
+		if (s_methodCache.TryGetValue(method, lowering))
+		{
+			return lowering;
+		}
+
+		IntrinsicMap* intrinsics = il2cpp::os::Atomic::ReadPointer(&s_intrinsics);
+		lowering = nullptr;
+		if (intrinsics)
+		{
+			auto it = intrinsics->find({ klass->namespaze, klass->name, method->name });
+			lowering = it != intrinsics->end() ? it->second : nullptr;
+		}
+
+		il2cpp::os::FastAutoLock lock(&s_lock);
+		// 查找期间注册表被替换时不缓存旧结果
+		if (s_intrinsics != intrinsics)
+		{
+			return lowering;
+		}
+		s_methodCache.Add(method, lowering);
+		return lowering;
+	}
+}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include "Transform.h"
+#include "TemporaryMemoryArena.h"
+
+namespace huatuo
+{
+namespace transform
+{
+	// 被替换为专用指令的调用点。args为eval stack上的实参(含this),返回值写到retOffset(第一个实参所在位置)
+	struct IntrinsicCallSite
+	{
+		TemporaryMemoryArena& pool;
+		std::vector<interpreter::IRCommon*>& insts;
+		const MethodInfo* method;
+		const EvalStackVarInfo* args;
+		int32_t retOffset;
+	};
+
+	// 返回false表示不支持该重载,按普通函数调用处理
+	typedef bool (*IntrinsicLowering)(IntrinsicCallSite& callSite);
+
+	// 以(命名空间, 类名, 函数名)注册调用的替换方式,同名重载共用一个lowering,由lowering根据参数类型区分。
+	// 只对AOT函数生效,热更新代码中同名的类型不受影响。
+	class Intrinsics
+	{
+	public:
+		// 注册内置的替换方式,在InterpreterModule::Initialize中调用
+		static void Initialize();
+
+		// 注册或覆盖一个替换方式,如引擎自己的数学库。需在Initialize之后调用。
+		// 可与后台转换并发,但已经转换过的函数不会重新生成,一般应在热更新函数开始执行之前注册
+		static void Register(const char* namespaze, const char* klassName, const char* methodName, IntrinsicLowering lowering);
+
+		// 线程安全,结果按MethodInfo缓存
+		static IntrinsicLowering Find(const MethodInfo* method);
+	};
+}
+}
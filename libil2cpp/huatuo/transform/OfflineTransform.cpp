@@ -0,0 +1,88 @@
+#include "OfflineTransform.h"
+
+#include "utils/Logging.h"
+#include "utils/StringUtils.h"
+#include "vm/Assembly.h"
+#include "vm/Method.h"
+
+#include "TransformCache.h"
+#include "../metadata/Assembly.h"
+#include "../metadata/MetadataModule.h"
+#include "../metadata/MetadataUtil.h"
+#include "../interpreter/InterpreterModule.h"
+
+namespace huatuo
+{
+namespace transform
+{
+
+	static std::string GetExceptionMessage(const Il2CppExceptionWrapper& ex)
+	{
+		if (ex.ex && ex.ex->message)
+		{
+			return il2cpp::utils::StringUtils::Utf16ToUtf8(ex.ex->message->chars, ex.ex->message->length);
+		}
+		return "";
+	}
+
+	bool OfflineTransform::TransformAssemblyFile(const char* assemblyFile, const char* outputDir, OfflineTransformResult& result)
+	{
+		result = {};
+		Il2CppAssembly* ass;
+		try
+		{
+			ass = metadata::Assembly::LoadFromFile(assemblyFile);
+		}
+		catch (Il2CppExceptionWrapper& ex)
+		{
+			il2cpp::utils::Logging::Write("[huatuo] load %s fail. %s", assemblyFile, GetExceptionMessage(ex).c_str());
+			return false;
+		}
+		if (!ass)
+		{
+			il2cpp::utils::Logging::Write("[huatuo] open %s fail", assemblyFile);
+			return false;
+		}
+
+		TransformCache::SetCacheDirectory(outputDir);
+		metadata::Image* image = metadata::MetadataModule::GetImage(ass->image);
+		result.methodCount = image->GetMethodCount();
+		for (uint32_t index = 0; index < result.methodCount; index++)
+		{
+			const MethodInfo* method = nullptr;
+			try
+			{
+				method = image->GetMethodInfoFromMethodDefinitionRawIndex(index);
+				// 泛型函数要到实例化后才能转换
+				if (method->is_generic || method->klass->is_generic || !image->GetMethodBody(method->token).ilcodes)
+				{
+					++result.skippedCount;
+					continue;
+				}
+				interpreter::InterpreterModule::GetInterpMethodInfo(image, method);
+				++result.transformedCount;
+			}
+			catch (Il2CppExceptionWrapper& ex)
+			{
+				std::string name = method ? il2cpp::vm::Method::GetFullName(method) : "method#" + std::to_string(index);
+				result.failedMethods.push_back(name);
+				il2cpp::utils::Logging::Write("[huatuo] transform %s fail. %s", name.c_str(), GetExceptionMessage(ex).c_str());
+			}
+		}
+		TransformCache::Save();
+		return true;
+	}
+}
+}
+
+int32_t huatuo_offline_transform(const char* assemblyFile, const char* outputDir)
+{
+	huatuo::transform::OfflineTransformResult result;
+	if (!huatuo::transform::OfflineTransform::TransformAssemblyFile(assemblyFile, outputDir, result))
+	{
+		return -1;
+	}
+	il2cpp::utils::Logging::Write("[huatuo] %s methods:%u transformed:%u skipped:%u failed:%u", assemblyFile,
+		result.methodCount, result.transformedCount, result.skippedCount, (uint32_t)result.failedMethods.size());
+	return (int32_t)result.failedMethods.size();
+}
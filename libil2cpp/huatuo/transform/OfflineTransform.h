@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../CommonDef.h"
+
+namespace huatuo
+{
+namespace transform
+{
+	struct OfflineTransformResult
+	{
+		uint32_t methodCount;
+		uint32_t transformedCount;
+		uint32_t skippedCount; // 泛型函数及无函数体的函数
+		std::vector<std::string> failedMethods;
+	};
+
+	// 在打包机上预先转换热更新dll的全部非泛型函数,结果以TransformCache格式写入outputDir,
+	// 随dll一起发布。需在加载了与发布包相同AOT程序集的il2cpp运行时中执行(如Linux headless player)。
+	class OfflineTransform
+	{
+	public:
+		static bool TransformAssemblyFile(const char* assemblyFile, const char* outputDir, OfflineTransformResult& result);
+	};
+}
+}
+
+extern "C"
+{
+	// 返回转换失败的函数个数,dll加载失败时返回-1。失败的函数名输出到日志
+	IL2CPP_EXPORT int32_t huatuo_offline_transform(const char* assemblyFile, const char* outputDir);
+}
@@ -1,9 +1,12 @@
 #include "TemporaryMemoryArena.h"
 
+#include "os/ThreadLocalValue.h"
+
 namespace huatuo
 {
 namespace transform
 {
+	static il2cpp::os::ThreadLocalValue s_threadArena;
 
 	TemporaryMemoryArena::Block TemporaryMemoryArena::AllocBlock(size_t size)
 	{
@@ -11,6 +14,21 @@ namespace transform
 		return { data, size };
 	}
 
+	TemporaryMemoryArena::Block TemporaryMemoryArena::AcquireBlock(size_t size)
+	{
+		for (size_t i = 0; i < _freeBlocks.size(); i++)
+		{
+			if (_freeBlocks[i].size >= size)
+			{
+				Block block = _freeBlocks[i];
+				_freeBlocks[i] = _freeBlocks.back();
+				_freeBlocks.pop_back();
+				return block;
+			}
+		}
+		return AllocBlock(size);
+	}
+
 	void TemporaryMemoryArena::Begin()
 	{
 		IL2CPP_ASSERT(_buf == nullptr);
@@ -21,8 +39,6 @@ namespace transform
 
 	void TemporaryMemoryArena::End()
 	{
-		// TODO free too many blocks
-		//il2cpp::os::FastAutoLock lock(&s_poolLock);
 		if (_buf)
 		{
 			IL2CPP_FREE(_buf);
@@ -33,6 +49,80 @@ namespace transform
 		{
 			IL2CPP_FREE(block.data);
 		}
+		_useOuts.clear();
+		for (auto& block : _freeBlocks)
+		{
+			IL2CPP_FREE(block.data);
+		}
+		_freeBlocks.clear();
+	}
+
+	void TemporaryMemoryArena::Reset()
+	{
+		if (_buf)
+		{
+			_useOuts.push_back({ (void*)_buf, _size });
+			_buf = nullptr;
+			_size = _pos = 0;
+		}
+		size_t retainedSize = 0;
+		for (auto& block : _freeBlocks)
+		{
+			retainedSize += block.size;
+		}
+		for (auto& block : _useOuts)
+		{
+			if (retainedSize + block.size <= kMaxRetainedBlockSize)
+			{
+				_freeBlocks.push_back(block);
+				retainedSize += block.size;
+			}
+			else
+			{
+				IL2CPP_FREE(block.data);
+			}
+		}
+		_useOuts.clear();
+	}
+
+	TemporaryMemoryArenaScope::TemporaryMemoryArenaScope()
+	{
+		_arena = nullptr;
+		s_threadArena.GetValue((void**)&_arena);
+		if (_arena)
+		{
+			s_threadArena.SetValue(nullptr);
+		}
+		else
+		{
+			_arena = new TemporaryMemoryArena();
+		}
+	}
+
+	TemporaryMemoryArenaScope::~TemporaryMemoryArenaScope()
+	{
+		TemporaryMemoryArena* threadArena = nullptr;
+		s_threadArena.GetValue((void**)&threadArena);
+		if (threadArena)
+		{
+			delete _arena;
+		}
+		else
+		{
+			_arena->Reset();
+			s_threadArena.SetValue(_arena);
+		}
+	}
+
+	void TemporaryMemoryArenaScope::FreeCurrentThreadArena()
+	{
+		TemporaryMemoryArena* threadArena = nullptr;
+		s_threadArena.GetValue((void**)&threadArena);
+		if (threadArena)
+		{
+			s_threadArena.SetValue(nullptr);
+			delete threadArena;
+		}
 	}
 }
 }
\ No newline at end of file
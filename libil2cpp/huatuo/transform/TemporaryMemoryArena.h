@@ -3,6 +3,7 @@
 #include <stack>
 #include <cmath>
 #include <vector>
+#include <unordered_map>
 
 #include "../CommonDef.h"
 
@@ -11,6 +12,8 @@ namespace huatuo
 	namespace transform
 	{
 		const size_t kMinBlockSize = 1024 * 1024;
+		// Reset后保留的空闲块总大小上限,超出的块直接释放
+		const size_t kMaxRetainedBlockSize = 4 * kMinBlockSize;
 
 		class TemporaryMemoryArena
 		{
@@ -75,7 +78,8 @@ namespace huatuo
 					{
 						RequireSize(bytes);
 					}
-					T* ret = new (_buf + _pos) T[n];
+					// 块会被复用,内容不一定为0
+					T* ret = new (_buf + _pos) T[n]();
 					_pos += bytes;
 					return ret;
 				}
@@ -85,10 +89,25 @@ namespace huatuo
 				}
 			}
 
+			void* Alloc(size_t size)
+			{
+				_pos = (_pos + 7) & ~(size_t)7;
+				if (_pos + size > _size)
+				{
+					RequireSize(size);
+				}
+				void* ret = _buf + _pos;
+				_pos += size;
+				return ret;
+			}
+
 			void Begin();
 
 			void End();
 
+			// 回收全部已分配的内存,块留给之后的分配复用
+			void Reset();
+
 		private:
 			struct Block
 			{
@@ -103,19 +122,96 @@ namespace huatuo
 					_useOuts.push_back({ (void*)_buf, _size});
 				}
 
-				Block newBlock = AllocBlock(std::min(size, kMinBlockSize));
+				Block newBlock = AcquireBlock(std::max(size, kMinBlockSize));
 				_buf = (byte*)newBlock.data;
 				_size = newBlock.size;
 				_pos = 0;
 			}
 
+			Block AcquireBlock(size_t size);
 			static Block AllocBlock(size_t size);
 
 			std::vector<Block> _useOuts;
+			std::vector<Block> _freeBlocks;
 
 			byte* _buf;
 			size_t _size;
 			size_t _pos;
 		};
+
+		// 从arena分配的STL分配器。释放为空操作,内存随arena一起回收
+		template<typename T>
+		class ArenaAllocator
+		{
+		public:
+			typedef T value_type;
+
+			ArenaAllocator(TemporaryMemoryArena& arena) : _arena(&arena)
+			{
+
+			}
+
+			template<typename U>
+			ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.GetArena())
+			{
+
+			}
+
+			T* allocate(size_t n)
+			{
+				return (T*)_arena->Alloc(n * sizeof(T));
+			}
+
+			void deallocate(T*, size_t)
+			{
+
+			}
+
+			TemporaryMemoryArena* GetArena() const
+			{
+				return _arena;
+			}
+
+			template<typename U>
+			bool operator==(const ArenaAllocator<U>& other) const
+			{
+				return _arena == other.GetArena();
+			}
+
+			template<typename U>
+			bool operator!=(const ArenaAllocator<U>& other) const
+			{
+				return _arena != other.GetArena();
+			}
+
+		private:
+			TemporaryMemoryArena* _arena;
+		};
+
+		template<typename T>
+		using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+		template<typename K, typename V, typename Hash = std::hash<K>>
+		using ArenaUnorderedMap = std::unordered_map<K, V, Hash, std::equal_to<K>, ArenaAllocator<std::pair<const K, V>>>;
+
+		// 转换使用的arena。每个线程复用一个arena,转换结束时Reset而不是释放,
+		// 同一线程上嵌套转换时另建临时arena。
+		class TemporaryMemoryArenaScope
+		{
+		public:
+			TemporaryMemoryArenaScope();
+			~TemporaryMemoryArenaScope();
+
+			TemporaryMemoryArena& Get()
+			{
+				return *_arena;
+			}
+
+			// 线程退出时释放当前线程复用的arena
+			static void FreeCurrentThreadArena();
+
+		private:
+			TemporaryMemoryArena* _arena;
+		};
 	}
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "vm/String.h"
 
 #include "TemporaryMemoryArena.h"
+#include "IROptimizer.h"
+#include "Intrinsics.h"
 #include "../metadata/MetadataUtil.h"
 #include "../metadata/Opcodes.h"
 #include "../interpreter/Instruction.h"
@@ -90,6 +92,10 @@ namespace transform
 #define PushBranch(targetOffset)    { \
     IL2CPP_ASSERT(splitOffsets.find(targetOffset) != splitOffsets.end());\
     IRBasicBlock* targetBb = ip2bb[targetOffset]; \
+    if ((int32_t)(targetOffset) <= ipOffset) \
+    { \
+        targetBb->loopHeader = true; \
+    } \
     if (!targetBb->inPending) \
     { \
         targetBb->inPending = true; \
@@ -108,6 +114,11 @@ namespace transform
     }
 
 #define PopBranch() { \
+    if (lastBb) \
+    { \
+        lastBb->outStackSize = curStackSize; \
+        lastBb = nullptr; \
+    } \
     bool findNextFlow = false; \
     for (; nextFlowIdx < (int32_t)pendingFlows.size(); ) \
     { \
@@ -1132,7 +1143,7 @@ ip++;
 		return klass->valuetype ? (fieldInfo->offset - sizeof(Il2CppObject)) : fieldInfo->offset;
 	}
 
-	inline uint32_t GetOrAddResolveDataIndex(std::unordered_map<const void*, uint32_t>& ptr2Index, std::vector<const void*>& resolvedDatas, const void* ptr)
+	inline uint32_t GetOrAddResolveDataIndex(ArenaUnorderedMap<const void*, uint32_t>& ptr2Index, std::vector<const void*>& resolvedDatas, const void* ptr)
 	{
 		auto it = ptr2Index.find(ptr);
 		if (it != ptr2Index.end())
@@ -1461,6 +1472,16 @@ ip++;
 
 	}
 
+	// 没有类构造函数或类构造函数已执行完时,访问静态字段不必再检查
+	inline void ElideCCtorCheckIfInited(interpreter::IRCommon* ir, const FieldInfo* fieldInfo)
+	{
+		Il2CppClass* klass = fieldInfo->parent;
+		if (!klass->has_cctor || klass->cctor_finished)
+		{
+			ir->type = interpreter::GetCCtorFreeStaticFieldOpcode(ir->type);
+		}
+	}
+
 #define CI_createLdsfldAndReturn(type)      { \
     CreateIR(ir, LdsfldVarVar_##type); \
     ir->dst = dstIdx; \
@@ -1911,7 +1932,355 @@ ip++;
 		}
 	}
 
-	void HiTransform::Transform(metadata::Image* image, const MethodInfo* methodInfo, metadata::MethodBody& body, interpreter::InterpMethodInfo& result)
+	// 只内联IL足够短的函数,getter/setter一般在这个范围内(Debug编译会多出stloc/br.s/ldloc)
+	const uint32_t kMaxInlineMethodILSize = 24;
+	const uint32_t kMaxInlineMethodLocalVarCount = 2;
+	const int32_t kMaxInlineMethodEvalStackSize = 4;
+
+	struct InlineStackVar
+	{
+		EvalStackReduceDataType reduceType;
+		int32_t locOffset;
+	};
+
+	// 将只由ldarg/ldloc/stloc/ldc/ldfld/stfld/ldsfld/stsfld组成的直线代码函数展开到调用处,省去CallInterp的栈帧开销。
+	// 被调函数的参数直接引用调用者eval stack上的实参,局部变量及中间结果映射到tempOffset开始的临时位置,返回值写到argBaseOffset。
+	// 被调函数标记了MethodImplOptions.NoInlining时不内联。失败时不生成任何指令。
+	static bool TryInlineMethod(TemporaryMemoryArena& pool, metadata::Image* image, const MethodInfo* caller, const MethodInfo* callee, bool virtualCall,
+		const EvalStackVarInfo* callArgs, int32_t argBaseOffset, int32_t tempOffset, std::vector<IRCommon*>& insts, int32_t& maxStackSize)
+	{
+		Il2CppClass* klass = callee->klass;
+		if (callee == caller || klass->image != caller->klass->image
+			|| callee->is_inflated || callee->is_generic || klass->is_generic || klass->generic_class
+			|| (callee->iflags & (METHOD_IMPL_ATTRIBUTE_NOINLINING | METHOD_IMPL_ATTRIBUTE_SYNCHRONIZED))
+			|| (virtualCall && (callee->flags & METHOD_ATTRIBUTE_VIRTUAL) && !(callee->flags & METHOD_ATTRIBUTE_FINAL) && !(klass->flags & TYPE_ATTRIBUTE_SEALED)))
+		{
+			return false;
+		}
+		const metadata::MethodBody& body = image->GetMethodBody(callee->token);
+		if (!body.ilcodes || body.codeSize > kMaxInlineMethodILSize || !body.exceptionClauses.empty() || body.localVarCount > kMaxInlineMethodLocalVarCount)
+		{
+			return false;
+		}
+
+		bool instanceCall = IsInstanceMethod(callee);
+		// 调用静态函数会触发类构造函数,callvirt会检查this是否为空。展开后要由第一条有副作用的指令
+		// (访问本类静态字段,或对this的ldfld/stfld)完成同样的检查
+		bool needCCtorInit = !instanceCall && klass->has_cctor;
+		bool needNullCheck = virtualCall;
+		bool sideEffectEmitted = false;
+
+		InlineStackVar evalStack[kMaxInlineMethodEvalStackSize];
+		int32_t evalStackTop = 0;
+		InlineStackVar locals[kMaxInlineMethodLocalVarCount];
+		bool localInited[kMaxInlineMethodLocalVarCount] = {};
+		// 返回值可能比参数大,临时位置从两者之后开始,保证临时值复制到返回值位置时不重叠
+		int32_t curTempOffset = IsReturnVoidMethod(callee) ? tempOffset : std::max(tempOffset, argBaseOffset + GetTypeValueStackObjectCount(callee->return_type));
+		size_t originInstCount = insts.size();
+
+		auto fail = [&]()
+		{
+			insts.resize(originInstCount);
+			return false;
+		};
+		auto getArgReduceType = [&](int32_t argIdx)
+		{
+			if (instanceCall && argIdx == 0)
+			{
+				return klass->valuetype ? EvalStackReduceDataType::Ref : EvalStackReduceDataType::Obj;
+			}
+			return GetEvalStackReduceDataType(callee->parameters[argIdx - instanceCall].parameter_type);
+		};
+		auto allocTemp = [&](int32_t stackObjectCount)
+		{
+			int32_t dst = curTempOffset;
+			curTempOffset += stackObjectCount;
+			maxStackSize = std::max(maxStackSize, curTempOffset);
+			return dst;
+		};
+		// 返回值位置与参数位置重合,两者有重叠时也需要正确复制
+		auto overlapsReturnSlot = [&](int32_t srcBegin, int32_t srcEnd, int32_t stackObjectCount)
+		{
+			return stackObjectCount > 1 && srcBegin < argBaseOffset + stackObjectCount && srcEnd > argBaseOffset;
+		};
+		// 紧接着ret时结果直接写到返回值位置。多个StackObject的值用memcpy复制,源[srcBegin, srcEnd)与返回值位置重叠时仍写到临时位置
+		auto allocDst = [&](const byte* nextIp, int32_t stackObjectCount, int32_t srcBegin, int32_t srcEnd)
+		{
+			if (*nextIp == (byte)OpcodeValue::RET && !overlapsReturnSlot(srcBegin, srcEnd, stackObjectCount))
+			{
+				return argBaseOffset;
+			}
+			return allocTemp(stackObjectCount);
+		};
+		auto checkSideEffect = [&](bool triggerCCtor, bool checkThis)
+		{
+			if (!sideEffectEmitted)
+			{
+				if ((needCCtorInit && !triggerCCtor) || (needNullCheck && !checkThis))
+				{
+					return false;
+				}
+				sideEffectEmitted = true;
+			}
+			return true;
+		};
+
+		const byte* ipBase = body.ilcodes;
+		const byte* ipEnd = ipBase + body.codeSize;
+		for (const byte* ip = ipBase; ip < ipEnd; )
+		{
+			if (evalStackTop >= kMaxInlineMethodEvalStackSize)
+			{
+				return fail();
+			}
+			OpcodeValue opcode = (OpcodeValue)*ip;
+			switch (opcode)
+			{
+			case OpcodeValue::NOP:
+			{
+				ip++;
+				continue;
+			}
+			case OpcodeValue::LDARG_0:
+			case OpcodeValue::LDARG_1:
+			case OpcodeValue::LDARG_2:
+			case OpcodeValue::LDARG_3:
+			case OpcodeValue::LDARG_S:
+			{
+				int32_t argIdx = opcode == OpcodeValue::LDARG_S ? ip[1] : (int32_t)opcode - (int32_t)OpcodeValue::LDARG_0;
+				if (argIdx >= callee->parameters_count + instanceCall)
+				{
+					return fail();
+				}
+				evalStack[evalStackTop++] = { getArgReduceType(argIdx), callArgs[argIdx].locOffset };
+				ip += opcode == OpcodeValue::LDARG_S ? 2 : 1;
+				continue;
+			}
+			case OpcodeValue::LDLOC_0:
+			case OpcodeValue::LDLOC_1:
+			case OpcodeValue::LDLOC_2:
+			case OpcodeValue::LDLOC_3:
+			case OpcodeValue::LDLOC_S:
+			{
+				uint32_t locIdx = opcode == OpcodeValue::LDLOC_S ? ip[1] : (uint32_t)opcode - (uint32_t)OpcodeValue::LDLOC_0;
+				if (locIdx >= body.localVarCount || !localInited[locIdx])
+				{
+					return fail();
+				}
+				evalStack[evalStackTop++] = locals[locIdx];
+				ip += opcode == OpcodeValue::LDLOC_S ? 2 : 1;
+				continue;
+			}
+			case OpcodeValue::STLOC_0:
+			case OpcodeValue::STLOC_1:
+			case OpcodeValue::STLOC_2:
+			case OpcodeValue::STLOC_3:
+			case OpcodeValue::STLOC_S:
+			{
+				uint32_t locIdx = opcode == OpcodeValue::STLOC_S ? ip[1] : (uint32_t)opcode - (uint32_t)OpcodeValue::STLOC_0;
+				if (locIdx >= body.localVarCount || evalStackTop < 1)
+				{
+					return fail();
+				}
+				// 参数和临时位置在展开的代码中都不会被再次写入,局部变量直接引用值所在的位置
+				locals[locIdx] = evalStack[--evalStackTop];
+				localInited[locIdx] = true;
+				ip += opcode == OpcodeValue::STLOC_S ? 2 : 1;
+				continue;
+			}
+			case OpcodeValue::BR_S:
+			{
+				// Debug编译的函数在ret前会跳转到下一条指令
+				if (ip[1] != 0)
+				{
+					return fail();
+				}
+				ip += 2;
+				continue;
+			}
+			case OpcodeValue::LDNULL:
+			{
+				int32_t dst = allocDst(ip + 1, 1, 0, 0);
+				CreateIR(ir, LdnullVar);
+				ir->dst = dst;
+				insts.push_back(ir);
+				evalStack[evalStackTop++] = { EvalStackReduceDataType::Obj, dst };
+				ip++;
+				continue;
+			}
+			case OpcodeValue::LDC_I4_M1:
+			case OpcodeValue::LDC_I4_0:
+			case OpcodeValue::LDC_I4_1:
+			case OpcodeValue::LDC_I4_2:
+			case OpcodeValue::LDC_I4_3:
+			case OpcodeValue::LDC_I4_4:
+			case OpcodeValue::LDC_I4_5:
+			case OpcodeValue::LDC_I4_6:
+			case OpcodeValue::LDC_I4_7:
+			case OpcodeValue::LDC_I4_8:
+			case OpcodeValue::LDC_I4_S:
+			case OpcodeValue::LDC_I4:
+			case OpcodeValue::LDC_R4:
+			{
+				int32_t value;
+				int32_t size = 1;
+				EvalStackReduceDataType reduceType = EvalStackReduceDataType::I4;
+				switch (opcode)
+				{
+				case OpcodeValue::LDC_I4_S: value = GetI1(ip + 1); size = 2; break;
+				case OpcodeValue::LDC_I4: value = GetI4LittleEndian(ip + 1); size = 5; break;
+				case OpcodeValue::LDC_R4: value = GetI4LittleEndian(ip + 1); size = 5; reduceType = EvalStackReduceDataType::R4; break;
+				default: value = (int32_t)opcode - (int32_t)OpcodeValue::LDC_I4_0; break;
+				}
+				int32_t dst = allocDst(ip + size, 1, 0, 0);
+				CreateIR(ir, LdcVarConst_4);
+				ir->dst = dst;
+				ir->src = value;
+				insts.push_back(ir);
+				evalStack[evalStackTop++] = { reduceType, dst };
+				ip += size;
+				continue;
+			}
+			case OpcodeValue::LDC_I8:
+			case OpcodeValue::LDC_R8:
+			{
+				int32_t dst = allocDst(ip + 9, 1, 0, 0);
+				CreateIR(ir, LdcVarConst_8);
+				ir->dst = dst;
+				ir->src = GetI8LittleEndian(ip + 1);
+				insts.push_back(ir);
+				evalStack[evalStackTop++] = { opcode == OpcodeValue::LDC_I8 ? EvalStackReduceDataType::I8 : EvalStackReduceDataType::R8, dst };
+				ip += 9;
+				continue;
+			}
+			case OpcodeValue::LDFLD:
+			case OpcodeValue::STFLD:
+			case OpcodeValue::LDSFLD:
+			case OpcodeValue::STSFLD:
+			{
+				uint32_t token = (uint32_t)GetI4LittleEndian(ip + 1);
+				const FieldInfo* fieldInfo = image->GetFieldInfoFromToken(token, nullptr, nullptr, nullptr);
+				bool isStaticField = opcode == OpcodeValue::LDSFLD || opcode == OpcodeValue::STSFLD;
+				int32_t popCount = opcode == OpcodeValue::STFLD ? 2 : (opcode == OpcodeValue::LDSFLD ? 0 : 1);
+				if (!fieldInfo || isStaticField != ((fieldInfo->type->attrs & FIELD_ATTRIBUTE_STATIC) != 0) || evalStackTop < popCount)
+				{
+					return fail();
+				}
+				bool triggerCCtor = isStaticField && fieldInfo->parent == klass && fieldInfo->offset != THREAD_STATIC_FIELD_OFFSET;
+				bool checkThis = !isStaticField && instanceCall && evalStack[evalStackTop - popCount].locOffset == callArgs[0].locOffset;
+				if (!checkSideEffect(triggerCCtor, checkThis))
+				{
+					return fail();
+				}
+				evalStackTop -= popCount;
+				const InlineStackVar* operands = evalStack + evalStackTop;
+				IRCommon* ir;
+				switch (opcode)
+				{
+				case OpcodeValue::LDFLD:
+				{
+					bool valueTypeLdfld = operands[0].reduceType != EvalStackReduceDataType::Ref && fieldInfo->parent->valuetype;
+					int32_t srcBegin = operands[0].locOffset;
+					int32_t srcEnd = valueTypeLdfld ? srcBegin + (int32_t)((GetFieldOffset(fieldInfo) + GetTypeValueSize(fieldInfo->type) + sizeof(StackObject) - 1) / sizeof(StackObject)) : srcBegin;
+					int32_t dst = allocDst(ip + 5, GetTypeValueStackObjectCount(fieldInfo->type), srcBegin, srcEnd);
+					ir = valueTypeLdfld ?
+						CreateValueTypeLdfld(pool, dst, operands[0].locOffset, fieldInfo)
+						: CreateClassLdfld(pool, dst, operands[0].locOffset, fieldInfo);
+					evalStack[evalStackTop++] = { GetEvalStackReduceDataType(fieldInfo->type), dst };
+					break;
+				}
+				case OpcodeValue::STFLD:
+				{
+					ir = CreateStfld(pool, operands[0].locOffset, fieldInfo, operands[1].locOffset);
+					break;
+				}
+				case OpcodeValue::LDSFLD:
+				{
+					int32_t dst = allocDst(ip + 5, GetTypeValueStackObjectCount(fieldInfo->type), 0, 0);
+					ir = fieldInfo->offset != THREAD_STATIC_FIELD_OFFSET ? CreateLdsfld(pool, dst, fieldInfo) : CreateLdthreadlocal(pool, dst, fieldInfo);
+					ElideCCtorCheckIfInited(ir, fieldInfo);
+					evalStack[evalStackTop++] = { GetEvalStackReduceDataType(fieldInfo->type), dst };
+					break;
+				}
+				default:
+				{
+					ir = fieldInfo->offset != THREAD_STATIC_FIELD_OFFSET ? CreateStsfld(pool, fieldInfo, operands[0].locOffset) : CreateStthreadlocal(pool, fieldInfo, operands[0].locOffset);
+					ElideCCtorCheckIfInited(ir, fieldInfo);
+					break;
+				}
+				}
+				insts.push_back(ir);
+				ip += 5;
+				continue;
+			}
+			case OpcodeValue::RET:
+			{
+				if (ip + 1 != ipEnd || (!sideEffectEmitted && (needCCtorInit || needNullCheck)))
+				{
+					return fail();
+				}
+				if (IsReturnVoidMethod(callee))
+				{
+					return evalStackTop == 0 ? true : fail();
+				}
+				if (evalStackTop != 1)
+				{
+					return fail();
+				}
+				int32_t src = evalStack[0].locOffset;
+				if (src != argBaseOffset)
+				{
+					int32_t retSize = GetTypeValueSize(callee->return_type);
+					int32_t retStackObjectCount = GetTypeValueStackObjectCount(callee->return_type);
+					if (overlapsReturnSlot(src, src + retStackObjectCount, retStackObjectCount))
+					{
+						int32_t temp = allocTemp(retStackObjectCount);
+						insts.push_back(CreateAssignVarVar(pool, temp, src, retSize));
+						src = temp;
+					}
+					insts.push_back(CreateAssignVarVar(pool, argBaseOffset, src, retSize));
+				}
+				return true;
+			}
+			default:
+				return fail();
+			}
+		}
+		return fail();
+	}
+
+	// leave离开的每个try/finally(包含leave但不包含目标位置)都要执行finally。子句已按由内到外排列,
+	// 将这些finally的索引追加到indexes并以-1结尾,返回起始位置。没有需要执行的finally时返回-1,leave等同于br
+	static int32_t AddLeaveFinallyClauses(const std::vector<ExceptionClause>& clauses, int32_t leaveOffset, int32_t targetOffset, std::vector<int32_t>& indexes)
+	{
+		int32_t startIndex = -1;
+		for (size_t i = 0; i < clauses.size(); i++)
+		{
+			const ExceptionClause& ec = clauses[i];
+			if (ec.flags != CorILExceptionClauseType::Finally)
+			{
+				continue;
+			}
+			uint32_t tryEnd = ec.tryOffset + ec.tryLength;
+			bool containsLeave = (uint32_t)leaveOffset >= ec.tryOffset && (uint32_t)leaveOffset < tryEnd;
+			bool containsTarget = (uint32_t)targetOffset >= ec.tryOffset && (uint32_t)targetOffset < tryEnd;
+			if (containsLeave && !containsTarget)
+			{
+				if (startIndex < 0)
+				{
+					startIndex = (int32_t)indexes.size();
+				}
+				indexes.push_back((int32_t)i);
+			}
+		}
+		if (startIndex >= 0)
+		{
+			indexes.push_back(-1);
+		}
+		return startIndex;
+	}
+
+	void HiTransform::Transform(metadata::Image* image, const MethodInfo* methodInfo, metadata::MethodBody& body, interpreter::InterpMethodInfo& result, TransformTier tier)
 	{
 #pragma region header
 		const Il2CppGenericContext* genericContext = methodInfo->is_inflated ? &methodInfo->genericMethod->context : nullptr;
@@ -1920,7 +2289,8 @@ ip++;
 			(const Il2CppGenericContainer*)methodInfo->genericMethod->methodDefinition->genericContainerHandle :
 			(const Il2CppGenericContainer*)methodInfo->genericContainerHandle;
 
-		TemporaryMemoryArena pool;
+		TemporaryMemoryArenaScope poolScope;
+		TemporaryMemoryArena& pool = poolScope.Get();
 		BasicBlockSpliter bbc(body);
 		bbc.SplitBasicBlocks();
 
@@ -1958,18 +2328,16 @@ ip++;
 		EvalStackVarInfo* evalStack = pool.NewNAny<EvalStackVarInfo>(body.maxStack + 100);
 
 		std::vector<const void*>& resolveDatas = result.resolveDatas;
-		// TODO. alloc use pool
-		std::unordered_map<uint32_t, uint32_t> token2DataIdxs;
-		// TOTO. alloc use pool
-		std::unordered_map<const void*, uint32_t> ptr2DataIdxs;
+		ArenaUnorderedMap<uint32_t, uint32_t> token2DataIdxs(0, std::hash<uint32_t>(), std::equal_to<uint32_t>(), pool);
+		ArenaUnorderedMap<const void*, uint32_t> ptr2DataIdxs(0, std::hash<const void*>(), std::equal_to<const void*>(), pool);
 
 		resolveDatas.push_back(nullptr); // reserved
 
 
-		std::vector<int32_t*> relocationOffsets;
+		ArenaVector<int32_t*> relocationOffsets(pool);
 		// index, count 
 		std::vector<std::pair<int32_t, int32_t>> switchOffsetsInResolveData;
-		std::vector<FlowInfo*> pendingFlows;
+		ArenaVector<FlowInfo*> pendingFlows(pool);
 		int32_t nextFlowIdx = 0;
 
 		int32_t totalArgSize = 0;
@@ -2036,10 +2404,16 @@ ip++;
 		int32_t brOffset = 0;
 
 		const MethodInfo* shareMethod = nullptr;
+		bool optimize = tier == TransformTier::Optimized;
 
-		for (ExceptionClause& ec : body.exceptionClauses)
+		// 重定位时要修改子句中的偏移,子句数组需在此时一次分配好
+		result.exClauseCount = (uint32_t)body.exceptionClauses.size();
+		result.exClauses = result.exClauseCount > 0 ? (InterpExceptionClause*)IL2CPP_CALLOC(result.exClauseCount, sizeof(InterpExceptionClause)) : nullptr;
+		std::vector<int32_t> leaveFinallyClauseIndexes;
+		for (uint32_t exClauseIdx = 0; exClauseIdx < result.exClauseCount; exClauseIdx++)
 		{
-			InterpExceptionClause* iec = (InterpExceptionClause*)IL2CPP_MALLOC_ZERO(sizeof(InterpExceptionClause));
+			ExceptionClause& ec = body.exceptionClauses[exClauseIdx];
+			InterpExceptionClause* iec = result.exClauses + exClauseIdx;
 			iec->flags = ec.flags;
 			iec->tryBeginOffset = ec.tryOffset;
 			iec->tryEndOffset = ec.tryOffset + ec.tryLength;
@@ -2122,11 +2496,33 @@ ip++;
 				IL2CPP_ASSERT(false);
 			}
 			}
-			result.exClauses.push_back(iec);
 		}
 
 #pragma endregion
 
+		// 调用被替换为专用指令时返回true。callvirt只替换不会被重写的函数
+		auto tryLowerIntrinsicCall = [&](const MethodInfo* method, bool virtualCall)
+		{
+			IntrinsicLowering lowering = Intrinsics::Find(method);
+			if (!lowering || (virtualCall && (method->flags & METHOD_ATTRIBUTE_VIRTUAL) && !(method->flags & METHOD_ATTRIBUTE_FINAL) && !(method->klass->flags & TYPE_ATTRIBUTE_SEALED)))
+			{
+				return false;
+			}
+			int32_t argCount = method->parameters_count + IsInstanceMethod(method);
+			int32_t argEvalStackIdxBase = evalStackTop - argCount;
+			IntrinsicCallSite callSite = { pool, curbb->insts, method, evalStack + argEvalStackIdxBase, GetEvalStackOffset(argEvalStackIdxBase) };
+			if (!lowering(callSite))
+			{
+				return false;
+			}
+			PopStackN(argCount);
+			if (!IsReturnVoidMethod(method))
+			{
+				PushStackByType(method->return_type);
+			}
+			return true;
+		};
+
 		IRBasicBlock* lastBb = nullptr;
 		for (;;)
 		{
@@ -2134,9 +2530,14 @@ ip++;
 			curbb = ip2bb[ipOffset];
 			if (curbb != lastBb)
 			{
+				if (lastBb)
+				{
+					lastBb->outStackSize = curStackSize;
+				}
 				if (curbb && !curbb->visited)
 				{
 					curbb->visited = true;
+					curbb->inStackSize = curStackSize;
 					lastBb = curbb;
 				}
 				else
@@ -2410,217 +2811,12 @@ ip++;
 			{
 				IL2CPP_ASSERT(shareMethod);
 				Il2CppClass* klass = shareMethod->klass;
-				const char* klassName = klass->name;
-				const char* methodName = shareMethod->name;
-#pragma region instrinct
-				if (std::strcmp(klass->namespaze, "System") == 0)
+				if (tryLowerIntrinsicCall(shareMethod, false))
 				{
-					uint32_t paramCount = shareMethod->parameters_count;
-					if (std::strcmp(klassName, "Object") == 0)
-					{
-						// special handle
-						if (strcmp(methodName, ".ctor") == 0)
-						{
-							PopStack();
-							continue;
-						}
-						// get_HasValue
-						// do nothing
-					}
-					else if (std::strcmp(klassName, "Nullable`1") == 0)
-					{
-						uint32_t eleSize = GetTypeValueSize(klass->castClass);
-						uint16_t topOffset = GetEvalStackTopOffset();
-						if (strcmp(methodName, ".ctor") == 0)
-						{
-							if (paramCount == 1)
-							{
-								CreateAddIR(ir, NullableCtorVarVar);
-								ir->dst = GetEvalStackOffset_2();
-								ir->data = GetEvalStackOffset_1();
-								ir->size = eleSize;
-
-								PopStackN(2);
-								continue;
-							}
-						}
-						else if (strcmp(methodName, "GetValueOrDefault") == 0)
-						{
-							if (paramCount == 0)
-							{
-								CreateAddIR(ir, NullableGetValueOrDefaultVarVar);
-								ir->dst = topOffset;
-								ir->obj = topOffset;
-								ir->size = eleSize;
-
-								// pop this, push value
-								PopStack();
-								PushStackByType(&klass->castClass->byval_arg);
-								continue;
-							}
-							else if (paramCount == 1)
-							{
-								CreateAddIR(ir, NullableGetValueOrDefaultVarVar_1);
-								ir->dst = ir->obj = GetEvalStackOffset_2();
-								ir->defaultValue = topOffset;
-								ir->size = eleSize;
-
-								// pop this, default value then push value
-								PopStackN(2);
-								PushStackByType(&klass->castClass->byval_arg);
-								continue;
-							}
-						}
-						else if (strcmp(methodName, "get_HasValue") == 0)
-						{
-							CreateAddIR(ir, NullableHasValueVar);
-							ir->result = topOffset;
-							ir->obj = topOffset;
-							ir->offset = eleSize;
-
-							// pop this, push value
-							PopStack();
-							PushStackByReduceType(EvalStackReduceDataType::I4);
-							continue;
-						}
-						else if (strcmp(methodName, "get_Value") == 0)
-						{
-							CreateAddIR(ir, NullableGetValueVarVar);
-							ir->dst = topOffset;
-							ir->obj = topOffset;
-							ir->size = eleSize;
-
-							// pop this, push value
-							PopStack();
-							PushStackByType(&klass->castClass->byval_arg);
-							continue;
-						}
-					}
-				}
-				else if (strcmp(klass->namespaze, "System.Threading") == 0 && shareMethod->methodPointer == nullptr)
-				{
-					if (strcmp(klassName, "Interlocked") == 0)
-					{
-						if (strcmp(methodName, "CompareExchange") == 0)
-						{
-							IL2CPP_ASSERT(evalStackTop >= 3);
-							uint16_t retIdx = GetEvalStackOffset_3();
-							uint16_t locationIdx = retIdx;
-							uint16_t valueIdx = GetEvalStackOffset_2();
-							uint16_t comparandIdx = GetEvalStackOffset_1();
-
-							CreateAddIR(ir, InterlockedCompareExchangeVarVarVarVar_pointer);
-							ir->ret = retIdx;
-							ir->localtion = locationIdx;
-							ir->value = valueIdx;
-							ir->comparand = comparandIdx;
-
-							const Il2CppType* paramType = shareMethod->parameters[1].parameter_type;
-							if (!paramType->byref)
-							{
-								Il2CppClass* paramKlass = il2cpp::vm::Class::FromIl2CppType(paramType);
-								if (paramKlass->valuetype)
-								{
-									uint32_t valueSize = GetTypeValueSize(paramKlass);
-									if (valueSize == 4)
-									{
-										ir->type = HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i4;
-									}
-									else if (valueSize == 8)
-									{
-										ir->type = HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i8;
-									}
-									else
-									{
-										RaiseExecuteEngineException("not support System.Threading.Interlocked.CompareExchange");
-									}
-								}
-							}
-							PopStackN(3);
-							PushStackByType(paramType);
-
-							continue;
-						}
-						else if (strcmp(methodName, "Exchange") == 0)
-						{
-							IL2CPP_ASSERT(evalStackTop >= 3);
-							uint16_t retIdx = GetEvalStackOffset_2();
-							uint16_t locationIdx = retIdx;
-							uint16_t valueIdx = GetEvalStackOffset_1();
-
-							CreateAddIR(ir, InterlockedExchangeVarVarVar_pointer);
-							ir->ret = retIdx;
-							ir->localtion = locationIdx;
-							ir->value = valueIdx;
-
-							const Il2CppType* paramType = shareMethod->parameters[1].parameter_type;
-							if (!paramType->byref)
-							{
-								Il2CppClass* paramKlass = il2cpp::vm::Class::FromIl2CppType(paramType);
-								if (paramKlass->valuetype)
-								{
-									uint32_t valueSize = GetTypeValueSize(paramKlass);
-									if (valueSize == 4)
-									{
-										ir->type = HiOpcodeEnum::InterlockedExchangeVarVarVar_i4;
-									}
-									else if (valueSize == 8)
-									{
-										ir->type = HiOpcodeEnum::InterlockedExchangeVarVarVar_i8;
-									}
-									else
-									{
-										RaiseExecuteEngineException("not support System.Threading.Interlocked.Exchange");
-									}
-								}
-							}
-							PopStackN(2);
-							PushStackByType(paramType);
-							continue;
-						}
-					}
-				}
-				else if (strcmp(klass->namespaze, "UnityEngine") == 0)
-				{
-					if (strcmp(methodName, ".ctor") == 0)
-					{
-						if (strcmp(klassName, "Vector2") == 0)
-						{
-							IL2CPP_ASSERT(evalStackTop >= 3);
-							CreateAddIR(ir, NewVector2VarVarVar);
-							ir->obj = GetEvalStackOffset_3();
-							ir->x = GetEvalStackOffset_2();
-							ir->y = GetEvalStackOffset_1();
-							PopStackN(3);
-							continue;
-						}
-						else if (strcmp(klassName, "Vector3") == 0)
-						{
-							IL2CPP_ASSERT(evalStackTop >= 4);
-							CreateAddIR(ir, NewVector3VarVarVarVar);
-							ir->obj = GetEvalStackOffset_4();
-							ir->x = GetEvalStackOffset_3();
-							ir->y = GetEvalStackOffset_2();
-							ir->z = GetEvalStackOffset_1();
-							PopStackN(4);
-							continue;
-						}
-						else if (strcmp(klassName, "Vector4") == 0)
-						{
-							IL2CPP_ASSERT(evalStackTop >= 5);
-							CreateAddIR(ir, NewVector4VarVarVarVarVar);
-							ir->obj = GetEvalStackOffset_5();
-							ir->x = GetEvalStackOffset_4();
-							ir->y = GetEvalStackOffset_3();
-							ir->z = GetEvalStackOffset_2();
-							ir->w = GetEvalStackOffset_1();
-							PopStackN(5);
-							continue;
-						}
-					}
+					continue;
 				}
-
-				// warn! can't change to else if. because namespace == system
+#pragma region instrinct
+				// 多维数组的Get/Set/Address是运行时生成的函数,类名随元素类型变化,不能按名字注册
 				if (klass->byval_arg.type == IL2CPP_TYPE_ARRAY)
 				{
 					const char* methodName = shareMethod->name;
@@ -2667,6 +2863,16 @@ ip++;
 
 				if (huatuo::metadata::IsInterpreterType(klass))
 				{
+					if (optimize && TryInlineMethod(pool, image, methodInfo, shareMethod, false, evalStack + callArgEvalStackIdxBase,
+						GetEvalStackOffset(callArgEvalStackIdxBase), GetEvalStackNewTopOffset(), curbb->insts, maxStackSize))
+					{
+						PopStackN(resolvedTotalArgdNum);
+						if (!IsReturnVoidMethod(shareMethod))
+						{
+							PushStackByType(shareMethod->return_type);
+						}
+						continue;
+					}
 					PopStackN(resolvedTotalArgdNum);
 
 					uint16_t argBaseOffset = (uint16_t)GetEvalStackOffset(callArgEvalStackIdxBase);
@@ -2770,17 +2976,36 @@ ip++;
 				int32_t resolvedTotalArgdNum = shareMethod->parameters_count + 1;
 				int32_t callArgEvalStackIdxBase = evalStackTop - resolvedTotalArgdNum;
 
+				if (tryLowerIntrinsicCall(shareMethod, true))
+				{
+					continue;
+				}
+
 				bool isMultiDelegate = IsMulticastDelegate(shareMethod);
 				if (!isMultiDelegate && IsInterpreterMethod(shareMethod))
 				{
+					if (optimize && TryInlineMethod(pool, image, methodInfo, shareMethod, true, evalStack + callArgEvalStackIdxBase,
+						GetEvalStackOffset(callArgEvalStackIdxBase), GetEvalStackNewTopOffset(), curbb->insts, maxStackSize))
+					{
+						PopStackN(resolvedTotalArgdNum);
+						if (!IsReturnVoidMethod(shareMethod))
+						{
+							PushStackByType(shareMethod->return_type);
+						}
+						continue;
+					}
 					PopStackN(resolvedTotalArgdNum);
 
 					uint16_t argBaseOffset = (uint16_t)GetEvalStackOffset(callArgEvalStackIdxBase);
+					int32_t inlineCacheDataIndex;
+					VirtualCallInlineCache* __inlineCache;
+					AllocResolvedData(resolveDatas, kVirtualCallInlineCacheSlotCount, inlineCacheDataIndex, __inlineCache);
 					if (IsReturnVoidMethod(shareMethod))
 					{
 						CreateAddIR(ir, CallInterpVirtual_void);
 						ir->method = const_cast<MethodInfo*>(shareMethod);
 						ir->argBase = argBaseOffset;
+						ir->inlineCache = inlineCacheDataIndex;
 					}
 					else
 					{
@@ -2788,6 +3013,7 @@ ip++;
 						ir->method = const_cast<MethodInfo*>(shareMethod);
 						ir->argBase = argBaseOffset;
 						ir->ret = argBaseOffset;
+						ir->inlineCache = inlineCacheDataIndex;
 						PushStackByType(shareMethod->return_type);
 					}
 					continue;
@@ -2848,12 +3074,16 @@ ip++;
 				}
 				if (!isMultiDelegate)
 				{
+					int32_t inlineCacheDataIndex;
+					VirtualCallInlineCache* __inlineCache;
+					AllocResolvedData(resolveDatas, kVirtualCallInlineCacheSlotCount, inlineCacheDataIndex, __inlineCache);
 					if (retIdx < 0)
 					{
 						CreateAddIR(ir, CallVirtual_void);
 						ir->managed2NativeMethod = managed2NativeMethodDataIdx;
 						ir->methodInfo = methodDataIndex;
 						ir->argIdxs = argIdxDataIndex;
+						ir->inlineCache = inlineCacheDataIndex;
 					}
 					else
 					{
@@ -2862,6 +3092,7 @@ ip++;
 						ir->methodInfo = methodDataIndex;
 						ir->argIdxs = argIdxDataIndex;
 						ir->ret = retIdx;
+						ir->inlineCache = inlineCacheDataIndex;
 					}
 				}
 				else
@@ -2870,12 +3101,21 @@ ip++;
 					Managed2NativeCallMethod staticManaged2NativeMethod = InterpreterModule::GetManaged2NativeMethodPointer(shareMethod, true);
 					IL2CPP_ASSERT(staticManaged2NativeMethod);
 					uint32_t staticManaged2NativeMethodDataIdx = GetOrAddResolveDataIndex(ptr2DataIdxs, resolveDatas, (void*)staticManaged2NativeMethod);
+
+					// 多播委托的调用状态: 委托列表, 下一个调用索引, 非最后一个委托的返回值
+					int32_t invokeStateIdx = std::max(bigValueTypeRefStackIdx, (int32_t)GetEvalStackNewTopOffset());
+					int32_t invokeStateSize = 2 + (retIdx < 0 ? 0 : GetTypeValueStackObjectCount(returnType));
+					IL2CPP_ASSERT(invokeStateIdx + invokeStateSize < MAX_STACK_SIZE);
+					maxStackSize = std::max(maxStackSize, invokeStateIdx + invokeStateSize);
+					CreateAddIR(initState, LdnullVar);
+					initState->dst = (uint16_t)invokeStateIdx;
 					if (retIdx < 0)
 					{
 						CreateAddIR(ir, CallDelegate_void);
 						ir->managed2NativeStaticMethod = staticManaged2NativeMethodDataIdx;
 						ir->managed2NativeInstanceMethod = managed2NativeMethodDataIdx;
 						ir->argIdxs = argIdxDataIndex;
+						ir->invokeState = (uint16_t)invokeStateIdx;
 					}
 					else
 					{
@@ -2884,6 +3124,7 @@ ip++;
 						ir->managed2NativeInstanceMethod = managed2NativeMethodDataIdx;
 						ir->argIdxs = argIdxDataIndex;
 						ir->ret = retIdx;
+						ir->invokeState = (uint16_t)invokeStateIdx;
 					}
 				}
 				continue;
@@ -3009,9 +3250,20 @@ ip++;
 			{
 				brOffset = GetI1(ip + 1);
 				int32_t targetOffset = ipOffset + brOffset + 2;
-				CreateAddIR(ir, LeaveEx);
-				ir->offset = targetOffset;
-				PUSH_OFFSET(&ir->offset);
+				int32_t finallyIndex = AddLeaveFinallyClauses(body.exceptionClauses, ipOffset, targetOffset, leaveFinallyClauseIndexes);
+				if (finallyIndex >= 0)
+				{
+					CreateAddIR(ir, LeaveEx);
+					ir->offset = targetOffset;
+					ir->finallyIndex = finallyIndex;
+					PUSH_OFFSET(&ir->offset);
+				}
+				else
+				{
+					CreateAddIR(ir, BranchUncondition_4);
+					ir->offset = targetOffset;
+					PUSH_OFFSET(&ir->offset);
+				}
 				PopAllStack();
 				PushBranch(targetOffset);
 				PopBranch();
@@ -3108,9 +3360,20 @@ ip++;
 			{
 				brOffset = GetI4LittleEndian(ip + 1);
 				int32_t targetOffset = ipOffset + brOffset + 5;
-				CreateAddIR(ir, LeaveEx);
-				ir->offset = targetOffset;
-				PUSH_OFFSET(&ir->offset);
+				int32_t finallyIndex = AddLeaveFinallyClauses(body.exceptionClauses, ipOffset, targetOffset, leaveFinallyClauseIndexes);
+				if (finallyIndex >= 0)
+				{
+					CreateAddIR(ir, LeaveEx);
+					ir->offset = targetOffset;
+					ir->finallyIndex = finallyIndex;
+					PUSH_OFFSET(&ir->offset);
+				}
+				else
+				{
+					CreateAddIR(ir, BranchUncondition_4);
+					ir->offset = targetOffset;
+					PUSH_OFFSET(&ir->offset);
+				}
 				PopAllStack();
 				PushBranch(targetOffset);
 				PopBranch();
@@ -4276,6 +4539,7 @@ ip++;
 				IRCommon* ir = fieldInfo->offset != THREAD_STATIC_FIELD_OFFSET ?
 					CreateLdsfld(pool, dstIdx, fieldInfo)
 					: CreateLdthreadlocal(pool, dstIdx, fieldInfo);
+				ElideCCtorCheckIfInited(ir, fieldInfo);
 				AddInst(ir);
 				PushStackByType(fieldInfo->type);
 
@@ -4298,6 +4562,7 @@ ip++;
 					ir->dst = dstIdx;
 					ir->klass = fieldInfo->parent;
 					ir->offset = fieldInfo->offset;
+					ElideCCtorCheckIfInited(ir, fieldInfo);
 				}
 				else
 				{
@@ -4305,6 +4570,7 @@ ip++;
 					ir->dst = dstIdx;
 					ir->klass = fieldInfo->parent;
 					ir->offset = GetThreadStaticFieldOffset(fieldInfo);
+					ElideCCtorCheckIfInited(ir, fieldInfo);
 				}
 				PushStackByReduceType(EvalStackReduceDataType::Ref);
 
@@ -4324,6 +4590,7 @@ ip++;
 				IRCommon* ir = fieldInfo->offset != THREAD_STATIC_FIELD_OFFSET ?
 					CreateStsfld(pool, fieldInfo, dataIdx)
 					: CreateStthreadlocal(pool, fieldInfo, dataIdx);
+				ElideCCtorCheckIfInited(ir, fieldInfo);
 				AddInst(ir);
 
 				PopStack();
@@ -5218,9 +5485,9 @@ ip++;
 					uint32_t methodToken = (uint32_t)GetI4LittleEndian(ip + 2);
 					MethodInfo* methodInfo = const_cast<MethodInfo*>(image->GetMethodInfoFromToken(methodToken, klassContainer, methodContainer, genericContext));
 					CHECK_NOT_NULL_THROW(methodInfo);
-					CreateAddIR(ir, LdcVarConst_8);
+					CreateAddIR(ir, LdftnVar);
 					ir->dst = GetEvalStackNewTopOffset();
-					ir->src = (uint64_t)methodInfo;
+					ir->method = methodInfo;
 					PushStackByReduceType(EvalStackReduceDataType::Ref);
 					ip += 6;
 					continue;
@@ -5396,6 +5663,49 @@ ip++;
 		}
 	finish_transform:
 
+		// eval stack为空且不在异常处理块中的循环头可以栈上替换,此时两个版本的帧布局相同。
+		// 这些条件只取决于IL,基础版本和优化版本得到的循环头集合一致
+		auto isOsrLoopHeader = [&](IRBasicBlock* bb)
+		{
+			if (!bb->loopHeader || !bb->visited || bb->inStackSize != evalStackBaseOffset)
+			{
+				return false;
+			}
+			for (ExceptionClause& ec : body.exceptionClauses)
+			{
+				uint32_t handlerBegin = ec.flags == CorILExceptionClauseType::Filter ? ec.classTokenOrFilterOffset : ec.handlerOffsets;
+				if (bb->ilOffset >= handlerBegin && bb->ilOffset < ec.handlerOffsets + ec.handlerLength)
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+		if (optimize)
+		{
+			IROptimizer optimizer(pool, irbbs, relocationOffsets, evalStackBaseOffset, maxStackSize);
+			optimizer.PropagateCopies();
+			optimizer.FuseInstructions();
+		}
+		else if (InterpreterModule::GetTierUpBackEdgeThreshold() > 0)
+		{
+			// 跳转目标重定位到基本块起始,插在块首的计数指令每次循环都会执行
+			for (IRBasicBlock* bb : irbbs)
+			{
+				if (isOsrLoopHeader(bb))
+				{
+					CreateIR(ir, OsrLoopHeader);
+					ir->ilOffset = (int32_t)bb->ilOffset;
+					bb->insts.insert(bb->insts.begin(), ir);
+				}
+				else if (bb->loopHeader && bb->visited)
+				{
+					CreateIR(ir, TierUpLoopHeader);
+					bb->insts.insert(bb->insts.begin(), ir);
+				}
+			}
+		}
 
 		uint32_t totalSize = 0;
 		for (IRBasicBlock* bb : irbbs)
@@ -5468,6 +5778,34 @@ ip++;
 		result.localStackSize = totalArgLocalSize;
 		result.maxStackSize = maxStackSize;
 		result.isTrivialCopyArgs = isSimpleArgs;
+		result.isOptimized = optimize;
+		if (optimize)
+		{
+			std::vector<InterpOsrEntry> osrEntries;
+			for (IRBasicBlock* bb : irbbs)
+			{
+				if (isOsrLoopHeader(bb))
+				{
+					osrEntries.push_back({ (int32_t)bb->ilOffset, (int32_t)bb->codeOffset });
+				}
+			}
+			result.osrEntryCount = (uint32_t)osrEntries.size();
+			if (result.osrEntryCount > 0)
+			{
+				result.osrEntries = (InterpOsrEntry*)IL2CPP_MALLOC(result.osrEntryCount * sizeof(InterpOsrEntry));
+				std::memcpy(result.osrEntries, osrEntries.data(), result.osrEntryCount * sizeof(InterpOsrEntry));
+			}
+		}
+		result.leaveFinallyClauseIndexCount = (uint32_t)leaveFinallyClauseIndexes.size();
+		if (result.leaveFinallyClauseIndexCount > 0)
+		{
+			result.leaveFinallyClauseIndexes = (int32_t*)IL2CPP_MALLOC(result.leaveFinallyClauseIndexCount * sizeof(int32_t));
+			std::memcpy(result.leaveFinallyClauseIndexes, leaveFinallyClauseIndexes.data(), result.leaveFinallyClauseIndexCount * sizeof(int32_t));
+		}
+		else
+		{
+			result.leaveFinallyClauseIndexes = nullptr;
+		}
 	}
 }
 
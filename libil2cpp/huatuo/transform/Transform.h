@@ -13,8 +13,11 @@ namespace transform
 	{
 		bool visited;
 		bool inPending;
+		bool loopHeader; // 是向后跳转的目标
 		uint32_t ilOffset;
 		uint32_t codeOffset;
+		int32_t inStackSize; // 进入基本块时的eval stack大小
+		int32_t outStackSize; // 离开基本块时的eval stack大小,超出部分的变量在后继基本块中不再存活
 		std::vector<interpreter::IRCommon*> insts;
 	};
 
@@ -52,10 +55,16 @@ namespace transform
 		int32_t locOffset;
 	};
 
+	enum class TransformTier
+	{
+		Baseline, // 不做复制传播、指令合并和内联,并在循环头插入计数指令
+		Optimized,
+	};
+
 	class HiTransform
 	{
 	public:
-		static void Transform(metadata::Image* image, const MethodInfo* methodInfo, metadata::MethodBody& body, interpreter::InterpMethodInfo& result);
+		static void Transform(metadata::Image* image, const MethodInfo* methodInfo, metadata::MethodBody& body, interpreter::InterpMethodInfo& result, TransformTier tier);
 	};
 }
 }
\ No newline at end of file
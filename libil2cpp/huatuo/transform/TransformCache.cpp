@@ -0,0 +1,1279 @@
+#include "TransformCache.h"
+
+#include <string>
+#include <unordered_map>
+
+#include "os/File.h"
+#include "utils/MemoryMappedFile.h"
+#include "utils/PathUtils.h"
+#include "vm/Assembly.h"
+#include "vm/Class.h"
+#include "vm/MetadataCache.h"
+#include "vm/MetadataLock.h"
+#include "metadata/GenericMetadata.h"
+
+#include "../metadata/Assembly.h"
+#include "../metadata/MetadataUtil.h"
+#include "../interpreter/Instruction.h"
+#include "../interpreter/InterpreterModule.h"
+
+using namespace huatuo::interpreter;
+
+namespace huatuo
+{
+namespace transform
+{
+	const uint32_t kTransformCacheMagic = 0x43544848; // "HHTC"
+	const uint32_t kTransformCacheVersion = 3;
+
+	enum class RelocationKind : uint8_t
+	{
+		Class,
+		Method,
+		Managed2Native,
+		String,
+		InlineCache, // 运行时填充的调用点缓存,保存时清空,无需重定位
+	};
+
+	enum class RelocationTarget : uint8_t
+	{
+		Code,
+		ResolveData,
+		ExceptionClause,
+	};
+
+	struct InstructionRelocation
+	{
+		uint16_t fieldOffset;
+		RelocationKind kind;
+		bool resolveDataIndex; // 字段保存的是resolveDatas的索引
+	};
+
+	const int32_t kMaxInstructionRelocationCount = 3;
+
+	// 返回指令中指针字段的个数,-1表示指令包含无法重定位的指针
+	static int32_t GetInstructionRelocations(HiOpcodeEnum op, InstructionRelocation* relocs)
+	{
+		switch (op)
+		{
+		//!!!{{RELOCATION
+		case HiOpcodeEnum::NewClassVar:
+		case HiOpcodeEnum::NewValueTypeVar:
+			relocs[0] = { 4, RelocationKind::Managed2Native, false };
+			relocs[1] = { 12, RelocationKind::Method, false };
+			return 2;
+		case HiOpcodeEnum::NewClassVar_Ctor_0:
+		case HiOpcodeEnum::NewClassInterpVar:
+		case HiOpcodeEnum::NewClassInterpVar_Ctor_0:
+		case HiOpcodeEnum::NewValueTypeInterpVar:
+		case HiOpcodeEnum::LdftnVar:
+			relocs[0] = { 4, RelocationKind::Method, false };
+			return 1;
+		case HiOpcodeEnum::NewClassVar_NotCtor:
+		case HiOpcodeEnum::NewDelegate:
+		case HiOpcodeEnum::LdsfldVarVar_i1:
+		case HiOpcodeEnum::LdsfldVarVar_u1:
+		case HiOpcodeEnum::LdsfldVarVar_i2:
+		case HiOpcodeEnum::LdsfldVarVar_u2:
+		case HiOpcodeEnum::LdsfldVarVar_i4:
+		case HiOpcodeEnum::LdsfldVarVar_u4:
+		case HiOpcodeEnum::LdsfldVarVar_i8:
+		case HiOpcodeEnum::LdsfldVarVar_u8:
+		case HiOpcodeEnum::LdsfldVarVar_size_8:
+		case HiOpcodeEnum::LdsfldVarVar_size_12:
+		case HiOpcodeEnum::LdsfldVarVar_size_16:
+		case HiOpcodeEnum::LdsfldVarVar_size_20:
+		case HiOpcodeEnum::LdsfldVarVar_size_24:
+		case HiOpcodeEnum::LdsfldVarVar_size_28:
+		case HiOpcodeEnum::LdsfldVarVar_size_32:
+		case HiOpcodeEnum::LdsfldVarVar_n_2:
+		case HiOpcodeEnum::LdsfldVarVar_n_4:
+		case HiOpcodeEnum::LdsfldaVarVar:
+		case HiOpcodeEnum::LdthreadlocalaVarVar:
+		case HiOpcodeEnum::LdthreadlocalVarVar_i1:
+		case HiOpcodeEnum::LdthreadlocalVarVar_u1:
+		case HiOpcodeEnum::LdthreadlocalVarVar_i2:
+		case HiOpcodeEnum::LdthreadlocalVarVar_u2:
+		case HiOpcodeEnum::LdthreadlocalVarVar_i4:
+		case HiOpcodeEnum::LdthreadlocalVarVar_u4:
+		case HiOpcodeEnum::LdthreadlocalVarVar_i8:
+		case HiOpcodeEnum::LdthreadlocalVarVar_u8:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_8:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_12:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_16:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_20:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_24:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_28:
+		case HiOpcodeEnum::LdthreadlocalVarVar_size_32:
+		case HiOpcodeEnum::LdthreadlocalVarVar_n_2:
+		case HiOpcodeEnum::LdthreadlocalVarVar_n_4:
+		case HiOpcodeEnum::LdsfldInitedVarVar_i1:
+		case HiOpcodeEnum::LdsfldInitedVarVar_u1:
+		case HiOpcodeEnum::LdsfldInitedVarVar_i2:
+		case HiOpcodeEnum::LdsfldInitedVarVar_u2:
+		case HiOpcodeEnum::LdsfldInitedVarVar_i4:
+		case HiOpcodeEnum::LdsfldInitedVarVar_u4:
+		case HiOpcodeEnum::LdsfldInitedVarVar_i8:
+		case HiOpcodeEnum::LdsfldInitedVarVar_u8:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_8:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_12:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_16:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_20:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_24:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_28:
+		case HiOpcodeEnum::LdsfldInitedVarVar_size_32:
+		case HiOpcodeEnum::LdsfldInitedVarVar_n_2:
+		case HiOpcodeEnum::LdsfldInitedVarVar_n_4:
+		case HiOpcodeEnum::LdsfldaInitedVarVar:
+		case HiOpcodeEnum::LdthreadlocalaInitedVarVar:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_i1:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_u1:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_i2:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_u2:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_i4:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_u4:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_i8:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_u8:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_8:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_12:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_16:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_20:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_24:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_28:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_size_32:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_n_2:
+		case HiOpcodeEnum::LdthreadlocalInitedVarVar_n_4:
+			relocs[0] = { 4, RelocationKind::Class, false };
+			return 1;
+		case HiOpcodeEnum::BoxRefVarVar:
+		case HiOpcodeEnum::BoxVarVar:
+		case HiOpcodeEnum::UnBoxVarVar:
+		case HiOpcodeEnum::UnBoxAnyVarVar:
+		case HiOpcodeEnum::MakeRefVarVar:
+		case HiOpcodeEnum::RefAnyValueVarVar:
+		case HiOpcodeEnum::NewArrVarVar_4:
+		case HiOpcodeEnum::NewArrVarVar_8:
+		case HiOpcodeEnum::NewMdArrVarVar_length:
+			relocs[0] = { 6, RelocationKind::Class, false };
+			return 1;
+		case HiOpcodeEnum::LdvirftnVarVar:
+			relocs[0] = { 6, RelocationKind::Method, false };
+			return 1;
+		case HiOpcodeEnum::CallNative_void:
+		case HiOpcodeEnum::CallNative_ret:
+			relocs[0] = { 2, RelocationKind::Managed2Native, true };
+			relocs[1] = { 6, RelocationKind::Method, true };
+			return 2;
+		case HiOpcodeEnum::CallInterp_void:
+		case HiOpcodeEnum::CallInterp_ret:
+			relocs[0] = { 2, RelocationKind::Method, false };
+			return 1;
+		case HiOpcodeEnum::CallVirtual_void:
+			relocs[0] = { 2, RelocationKind::Managed2Native, true };
+			relocs[1] = { 6, RelocationKind::Method, true };
+			relocs[2] = { 14, RelocationKind::InlineCache, true };
+			return 3;
+		case HiOpcodeEnum::CallVirtual_ret:
+			relocs[0] = { 2, RelocationKind::Managed2Native, true };
+			relocs[1] = { 6, RelocationKind::Method, true };
+			relocs[2] = { 16, RelocationKind::InlineCache, true };
+			return 3;
+		case HiOpcodeEnum::CallInterpVirtual_void:
+			relocs[0] = { 2, RelocationKind::Method, false };
+			relocs[1] = { 12, RelocationKind::InlineCache, true };
+			return 2;
+		case HiOpcodeEnum::CallInterpVirtual_ret:
+			relocs[0] = { 2, RelocationKind::Method, false };
+			relocs[1] = { 14, RelocationKind::InlineCache, true };
+			return 2;
+		case HiOpcodeEnum::CallInd_void:
+		case HiOpcodeEnum::CallInd_ret:
+			relocs[0] = { 2, RelocationKind::Managed2Native, true };
+			return 1;
+		case HiOpcodeEnum::CallDelegate_void:
+		case HiOpcodeEnum::CallDelegate_ret:
+			relocs[0] = { 2, RelocationKind::Managed2Native, true };
+			relocs[1] = { 6, RelocationKind::Managed2Native, true };
+			return 2;
+		case HiOpcodeEnum::CastclassVar:
+		case HiOpcodeEnum::IsInstVar:
+			relocs[0] = { 4, RelocationKind::Class, true };
+			return 1;
+		case HiOpcodeEnum::LdtokenVar:
+			return -1;
+		case HiOpcodeEnum::LdstrVar:
+			relocs[0] = { 4, RelocationKind::String, true };
+			return 1;
+		case HiOpcodeEnum::StsfldVarVar_i1:
+		case HiOpcodeEnum::StsfldVarVar_u1:
+		case HiOpcodeEnum::StsfldVarVar_i2:
+		case HiOpcodeEnum::StsfldVarVar_u2:
+		case HiOpcodeEnum::StsfldVarVar_i4:
+		case HiOpcodeEnum::StsfldVarVar_u4:
+		case HiOpcodeEnum::StsfldVarVar_i8:
+		case HiOpcodeEnum::StsfldVarVar_u8:
+		case HiOpcodeEnum::StsfldVarVar_size_8:
+		case HiOpcodeEnum::StsfldVarVar_size_12:
+		case HiOpcodeEnum::StsfldVarVar_size_16:
+		case HiOpcodeEnum::StsfldVarVar_size_20:
+		case HiOpcodeEnum::StsfldVarVar_size_24:
+		case HiOpcodeEnum::StsfldVarVar_size_28:
+		case HiOpcodeEnum::StsfldVarVar_size_32:
+		case HiOpcodeEnum::StsfldVarVar_n_2:
+		case HiOpcodeEnum::StsfldVarVar_n_4:
+		case HiOpcodeEnum::StthreadlocalVarVar_i1:
+		case HiOpcodeEnum::StthreadlocalVarVar_u1:
+		case HiOpcodeEnum::StthreadlocalVarVar_i2:
+		case HiOpcodeEnum::StthreadlocalVarVar_u2:
+		case HiOpcodeEnum::StthreadlocalVarVar_i4:
+		case HiOpcodeEnum::StthreadlocalVarVar_u4:
+		case HiOpcodeEnum::StthreadlocalVarVar_i8:
+		case HiOpcodeEnum::StthreadlocalVarVar_u8:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_8:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_12:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_16:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_20:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_24:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_28:
+		case HiOpcodeEnum::StthreadlocalVarVar_size_32:
+		case HiOpcodeEnum::StthreadlocalVarVar_n_2:
+		case HiOpcodeEnum::StthreadlocalVarVar_n_4:
+		case HiOpcodeEnum::StsfldInitedVarVar_i1:
+		case HiOpcodeEnum::StsfldInitedVarVar_u1:
+		case HiOpcodeEnum::StsfldInitedVarVar_i2:
+		case HiOpcodeEnum::StsfldInitedVarVar_u2:
+		case HiOpcodeEnum::StsfldInitedVarVar_i4:
+		case HiOpcodeEnum::StsfldInitedVarVar_u4:
+		case HiOpcodeEnum::StsfldInitedVarVar_i8:
+		case HiOpcodeEnum::StsfldInitedVarVar_u8:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_8:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_12:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_16:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_20:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_24:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_28:
+		case HiOpcodeEnum::StsfldInitedVarVar_size_32:
+		case HiOpcodeEnum::StsfldInitedVarVar_n_2:
+		case HiOpcodeEnum::StsfldInitedVarVar_n_4:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_i1:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_u1:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_i2:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_u2:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_i4:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_u4:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_i8:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_u8:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_8:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_12:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_16:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_20:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_24:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_28:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_size_32:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_n_2:
+		case HiOpcodeEnum::StthreadlocalInitedVarVar_n_4:
+			relocs[0] = { 2, RelocationKind::Class, false };
+			return 1;
+		case HiOpcodeEnum::GetArrayElementAddressCheckAddrVarVar_i4:
+		case HiOpcodeEnum::GetArrayElementAddressCheckAddrVarVar_i8:
+		case HiOpcodeEnum::SetArrayElementObjectCheckVarVar_4:
+		case HiOpcodeEnum::SetArrayElementObjectCheckVarVar_8:
+		case HiOpcodeEnum::NewMdArrVarVar_length_bound:
+			relocs[0] = { 8, RelocationKind::Class, false };
+			return 1;
+		//!!!}}RELOCATION
+		default:
+			return 0;
+		}
+	}
+
+	class CacheWriter
+	{
+	public:
+		CacheWriter(std::vector<byte>& buf) : _buf(buf)
+		{
+
+		}
+
+		size_t GetPosition() const
+		{
+			return _buf.size();
+		}
+
+		void WriteByte(uint8_t value)
+		{
+			_buf.push_back(value);
+		}
+
+		void WriteUInt32(uint32_t value)
+		{
+			WriteBytes(&value, sizeof(value));
+		}
+
+		void WriteUInt16At(size_t pos, uint16_t value)
+		{
+			std::memcpy(&_buf[pos], &value, sizeof(value));
+		}
+
+		void WriteUInt32At(size_t pos, uint32_t value)
+		{
+			std::memcpy(&_buf[pos], &value, sizeof(value));
+		}
+
+		void WriteBytes(const void* data, size_t size)
+		{
+			const byte* src = (const byte*)data;
+			_buf.insert(_buf.end(), src, src + size);
+		}
+
+		void WriteString(const char* str)
+		{
+			uint32_t len = (uint32_t)std::strlen(str);
+			WriteUInt32(len);
+			WriteBytes(str, len + 1);
+		}
+
+		void ZeroBytesAt(size_t pos, size_t size)
+		{
+			std::memset(&_buf[pos], 0, size);
+		}
+
+	private:
+		std::vector<byte>& _buf;
+	};
+
+	// 缓存文件可能损坏或被截断,所有读取都做越界检查
+	class CacheReader
+	{
+	public:
+		CacheReader(const byte* data, size_t size) : _data(data), _end(data + size), _failed(false)
+		{
+
+		}
+
+		bool IsFailed() const
+		{
+			return _failed;
+		}
+
+		bool IsEnd() const
+		{
+			return _data == _end;
+		}
+
+		const byte* ReadBytes(size_t size)
+		{
+			if (_failed || (size_t)(_end - _data) < size)
+			{
+				_failed = true;
+				return nullptr;
+			}
+			const byte* data = _data;
+			_data += size;
+			return data;
+		}
+
+		uint8_t ReadByte()
+		{
+			const byte* data = ReadBytes(1);
+			return data ? *data : 0;
+		}
+
+		uint32_t ReadUInt32()
+		{
+			const byte* data = ReadBytes(sizeof(uint32_t));
+			uint32_t value = 0;
+			if (data)
+			{
+				std::memcpy(&value, data, sizeof(value));
+			}
+			return value;
+		}
+
+		const char* ReadString()
+		{
+			uint32_t len = ReadUInt32();
+			const char* str = (const char*)ReadBytes((size_t)len + 1);
+			if (str && str[len] != 0)
+			{
+				_failed = true;
+				return nullptr;
+			}
+			return str;
+		}
+
+	private:
+		const byte* _data;
+		const byte* const _end;
+		bool _failed;
+	};
+
+#pragma region relocatable reference
+
+	static uint32_t HashName(const char* name)
+	{
+		return (uint32_t)CStringHash()(name);
+	}
+
+	static uint32_t HashTypeName(const Il2CppClass* klass)
+	{
+		return HashName(klass->namespaze) * 31 + HashName(klass->name);
+	}
+
+	// 类型定义按 assembly名 + typedef token 记录,加载时用名字的hash校验,防止引用的dll变化后解析到错误的类型
+	static bool WriteTypeDefinition(CacheWriter& writer, const Il2CppClass* klass)
+	{
+		if (!klass || !klass->image || !klass->image->assembly)
+		{
+			return false;
+		}
+		writer.WriteString(klass->image->assembly->aname.name);
+		writer.WriteUInt32(klass->token);
+		writer.WriteUInt32(HashTypeName(klass));
+		return true;
+	}
+
+	static Il2CppClass* ReadTypeDefinition(CacheReader& reader)
+	{
+		const char* assemblyName = reader.ReadString();
+		uint32_t token = reader.ReadUInt32();
+		uint32_t nameHash = reader.ReadUInt32();
+		if (reader.IsFailed())
+		{
+			return nullptr;
+		}
+		const Il2CppAssembly* ass = il2cpp::vm::Assembly::GetLoadedAssembly(assemblyName);
+		if (!ass)
+		{
+			return nullptr;
+		}
+		uint32_t rowIndex = metadata::DecodeTokenRowIndex(token);
+		if (rowIndex == 0 || rowIndex > ass->image->typeCount)
+		{
+			return nullptr;
+		}
+		Il2CppClass* klass = il2cpp::vm::MetadataCache::GetTypeInfoFromHandle(il2cpp::vm::MetadataCache::GetAssemblyTypeHandle(ass->image, rowIndex - 1));
+		return klass && klass->token == token && HashTypeName(klass) == nameHash ? klass : nullptr;
+	}
+
+	static bool WriteType(CacheWriter& writer, const Il2CppType* type);
+
+	static bool WriteGenericInst(CacheWriter& writer, const Il2CppGenericInst* inst)
+	{
+		uint32_t argc = inst ? inst->type_argc : 0;
+		writer.WriteUInt32(argc);
+		for (uint32_t i = 0; i < argc; i++)
+		{
+			if (!WriteType(writer, inst->type_argv[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool WriteType(CacheWriter& writer, const Il2CppType* type)
+	{
+		if (type->byref)
+		{
+			return false;
+		}
+		writer.WriteByte((uint8_t)type->type);
+		switch (type->type)
+		{
+		case IL2CPP_TYPE_VOID:
+		case IL2CPP_TYPE_BOOLEAN:
+		case IL2CPP_TYPE_CHAR:
+		case IL2CPP_TYPE_I1:
+		case IL2CPP_TYPE_U1:
+		case IL2CPP_TYPE_I2:
+		case IL2CPP_TYPE_U2:
+		case IL2CPP_TYPE_I4:
+		case IL2CPP_TYPE_U4:
+		case IL2CPP_TYPE_I8:
+		case IL2CPP_TYPE_U8:
+		case IL2CPP_TYPE_R4:
+		case IL2CPP_TYPE_R8:
+		case IL2CPP_TYPE_I:
+		case IL2CPP_TYPE_U:
+		case IL2CPP_TYPE_STRING:
+		case IL2CPP_TYPE_OBJECT:
+		case IL2CPP_TYPE_TYPEDBYREF:
+			return true;
+		case IL2CPP_TYPE_CLASS:
+		case IL2CPP_TYPE_VALUETYPE:
+			return WriteTypeDefinition(writer, il2cpp::vm::Class::FromIl2CppType(type, false));
+		case IL2CPP_TYPE_GENERICINST:
+		{
+			const Il2CppGenericClass* genericClass = type->data.generic_class;
+			return WriteTypeDefinition(writer, il2cpp::vm::Class::FromIl2CppType(genericClass->type, false))
+				&& WriteGenericInst(writer, genericClass->context.class_inst);
+		}
+		case IL2CPP_TYPE_SZARRAY:
+		case IL2CPP_TYPE_PTR:
+			return WriteType(writer, type->data.type);
+		case IL2CPP_TYPE_ARRAY:
+			writer.WriteByte(type->data.array->rank);
+			return WriteType(writer, type->data.array->etype);
+		default:
+			return false;
+		}
+	}
+
+	static Il2CppClass* ReadClass(CacheReader& reader);
+
+	static bool ReadGenericInst(CacheReader& reader, const Il2CppGenericInst*& inst)
+	{
+		uint32_t argc = reader.ReadUInt32();
+		if (reader.IsFailed())
+		{
+			return false;
+		}
+		if (argc == 0)
+		{
+			inst = nullptr;
+			return true;
+		}
+		il2cpp::metadata::Il2CppTypeVector types;
+		for (uint32_t i = 0; i < argc; i++)
+		{
+			Il2CppClass* klass = ReadClass(reader);
+			if (!klass)
+			{
+				return false;
+			}
+			types.push_back(&klass->byval_arg);
+		}
+		inst = il2cpp::vm::MetadataCache::GetGenericInst(types);
+		return true;
+	}
+
+	static Il2CppClass* ReadClass(CacheReader& reader)
+	{
+		Il2CppTypeEnum typeEnum = (Il2CppTypeEnum)reader.ReadByte();
+		if (reader.IsFailed())
+		{
+			return nullptr;
+		}
+		switch (typeEnum)
+		{
+		case IL2CPP_TYPE_VOID:
+		case IL2CPP_TYPE_BOOLEAN:
+		case IL2CPP_TYPE_CHAR:
+		case IL2CPP_TYPE_I1:
+		case IL2CPP_TYPE_U1:
+		case IL2CPP_TYPE_I2:
+		case IL2CPP_TYPE_U2:
+		case IL2CPP_TYPE_I4:
+		case IL2CPP_TYPE_U4:
+		case IL2CPP_TYPE_I8:
+		case IL2CPP_TYPE_U8:
+		case IL2CPP_TYPE_R4:
+		case IL2CPP_TYPE_R8:
+		case IL2CPP_TYPE_I:
+		case IL2CPP_TYPE_U:
+		case IL2CPP_TYPE_STRING:
+		case IL2CPP_TYPE_OBJECT:
+		case IL2CPP_TYPE_TYPEDBYREF:
+		{
+			Il2CppType type = {};
+			type.type = typeEnum;
+			return il2cpp::vm::Class::FromIl2CppType(&type, false);
+		}
+		case IL2CPP_TYPE_CLASS:
+		case IL2CPP_TYPE_VALUETYPE:
+			return ReadTypeDefinition(reader);
+		case IL2CPP_TYPE_GENERICINST:
+		{
+			Il2CppClass* genericTypeDef = ReadTypeDefinition(reader);
+			const Il2CppGenericInst* inst;
+			if (!genericTypeDef || !ReadGenericInst(reader, inst) || !inst)
+			{
+				return nullptr;
+			}
+			return il2cpp::vm::Class::GetInflatedGenericInstanceClass(genericTypeDef, inst);
+		}
+		case IL2CPP_TYPE_SZARRAY:
+		{
+			Il2CppClass* eleKlass = ReadClass(reader);
+			return eleKlass ? il2cpp::vm::Class::GetArrayClass(eleKlass, 1) : nullptr;
+		}
+		case IL2CPP_TYPE_PTR:
+		{
+			Il2CppClass* eleKlass = ReadClass(reader);
+			return eleKlass ? il2cpp::vm::Class::GetPtrClass(eleKlass) : nullptr;
+		}
+		case IL2CPP_TYPE_ARRAY:
+		{
+			uint8_t rank = reader.ReadByte();
+			Il2CppClass* eleKlass = ReadClass(reader);
+			return eleKlass ? il2cpp::vm::Class::GetBoundedArrayClass(eleKlass, rank, true) : nullptr;
+		}
+		default:
+			return nullptr;
+		}
+	}
+
+	// 泛型实例方法记录 方法定义 + 泛型参数,加载时重新Inflate
+	static bool WriteMethod(CacheWriter& writer, const MethodInfo* method)
+	{
+		const Il2CppGenericContext* genericContext = nullptr;
+		if (method->is_inflated)
+		{
+			genericContext = &method->genericMethod->context;
+			method = method->genericMethod->methodDefinition;
+		}
+		Il2CppClass* klass = method->klass;
+		il2cpp::vm::Class::SetupMethods(klass);
+		int32_t slot = -1;
+		for (uint16_t i = 0; i < klass->method_count; i++)
+		{
+			if (klass->methods[i] == method)
+			{
+				slot = i;
+				break;
+			}
+		}
+		if (slot < 0 || !WriteType(writer, &klass->byval_arg))
+		{
+			return false;
+		}
+		writer.WriteUInt32((uint32_t)slot);
+		writer.WriteUInt32(method->token);
+		writer.WriteUInt32(HashName(method->name));
+		return WriteGenericInst(writer, genericContext ? genericContext->class_inst : nullptr)
+			&& WriteGenericInst(writer, genericContext ? genericContext->method_inst : nullptr);
+	}
+
+	static const MethodInfo* ReadMethod(CacheReader& reader)
+	{
+		Il2CppClass* klass = ReadClass(reader);
+		uint32_t slot = reader.ReadUInt32();
+		uint32_t token = reader.ReadUInt32();
+		uint32_t nameHash = reader.ReadUInt32();
+		const Il2CppGenericInst* classInst;
+		const Il2CppGenericInst* methodInst;
+		if (!klass || !ReadGenericInst(reader, classInst) || !ReadGenericInst(reader, methodInst))
+		{
+			return nullptr;
+		}
+		il2cpp::vm::Class::SetupMethods(klass);
+		if (slot >= klass->method_count)
+		{
+			return nullptr;
+		}
+		const MethodInfo* method = klass->methods[slot];
+		if (method->token != token || HashName(method->name) != nameHash)
+		{
+			return nullptr;
+		}
+		if (classInst || methodInst)
+		{
+			Il2CppGenericContext genericContext = { classInst, methodInst };
+			method = il2cpp::metadata::GenericMetadata::Inflate(method, &genericContext);
+		}
+		return method;
+	}
+
+	static bool WriteReference(CacheWriter& writer, metadata::Image* image, RelocationKind kind, const void* ptr)
+	{
+		switch (kind)
+		{
+		case RelocationKind::Class:
+			return WriteType(writer, &((Il2CppClass*)ptr)->byval_arg);
+		case RelocationKind::Method:
+			return WriteMethod(writer, (const MethodInfo*)ptr);
+		case RelocationKind::Managed2Native:
+		{
+			const char* signature = InterpreterModule::GetManaged2NativeMethodSignature((Managed2NativeCallMethod)ptr);
+			if (!signature)
+			{
+				return false;
+			}
+			writer.WriteString(signature);
+			return true;
+		}
+		case RelocationKind::String:
+		{
+			StringIndex index;
+			if (!image->TryGetUserStringRawIndex((Il2CppString*)ptr, index))
+			{
+				return false;
+			}
+			writer.WriteUInt32((uint32_t)index);
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	static const void* ReadReference(CacheReader& reader, metadata::Image* image, RelocationKind kind)
+	{
+		switch (kind)
+		{
+		case RelocationKind::Class:
+			return ReadClass(reader);
+		case RelocationKind::Method:
+			return ReadMethod(reader);
+		case RelocationKind::Managed2Native:
+		{
+			const char* signature = reader.ReadString();
+			return signature ? (const void*)InterpreterModule::GetManaged2NativeMethodPointer(signature) : nullptr;
+		}
+		case RelocationKind::String:
+		{
+			uint32_t index = reader.ReadUInt32();
+			return reader.IsFailed() ? nullptr : image->GetIl2CppUserStringFromRawIndex((StringIndex)index);
+		}
+		default:
+			return nullptr;
+		}
+	}
+
+#pragma endregion
+
+#pragma region method entry
+
+	static bool WriteMethodKey(CacheWriter& writer, const MethodInfo* method)
+	{
+		writer.WriteUInt32(method->token);
+		const Il2CppGenericContext* genericContext = method->is_inflated ? &method->genericMethod->context : nullptr;
+		return WriteGenericInst(writer, genericContext ? genericContext->class_inst : nullptr)
+			&& WriteGenericInst(writer, genericContext ? genericContext->method_inst : nullptr);
+	}
+
+	// 缓存项格式:
+	//   InterpMethodInfo 标量字段, ArgDesc[], resolveDatas[], codes[], InterpExceptionClause[], leaveFinallyClauseIndexes[],
+	//   重定位表 { kind, target, position, reference }
+	// codes与resolveDatas中的指针在写入时清零,加载时按重定位表重新解析填入。
+	static bool WriteMethodData(CacheWriter& writer, metadata::Image* image, const InterpMethodInfo* imi)
+	{
+		writer.WriteUInt32(imi->argCount);
+		writer.WriteUInt32(imi->argStackObjectSize);
+		writer.WriteUInt32(imi->codeLength);
+		writer.WriteUInt32(imi->maxStackSize);
+		writer.WriteUInt32(imi->localVarBaseOffset);
+		writer.WriteUInt32(imi->evalStackBaseOffset);
+		writer.WriteUInt32(imi->localStackSize);
+		writer.WriteUInt32(imi->isTrivialCopyArgs);
+		writer.WriteUInt32(imi->isOptimized);
+		for (uint32_t i = 0; i < imi->argCount; i++)
+		{
+			writer.WriteUInt32((uint32_t)imi->args[i].type);
+			writer.WriteUInt32(imi->args[i].stackObjectSize);
+		}
+
+		uint32_t resolveDataCount = (uint32_t)imi->resolveDatas.size();
+		writer.WriteUInt32(resolveDataCount);
+		size_t resolveDataPos = writer.GetPosition();
+		writer.WriteBytes(imi->resolveDatas.data(), resolveDataCount * sizeof(void*));
+
+		size_t codePos = writer.GetPosition();
+		writer.WriteBytes(imi->codes, imi->codeLength);
+
+		writer.WriteUInt32(imi->exClauseCount);
+		for (uint32_t i = 0; i < imi->exClauseCount; i++)
+		{
+			const InterpExceptionClause& iec = imi->exClauses[i];
+			writer.WriteUInt32((uint32_t)iec.flags);
+			writer.WriteUInt32((uint32_t)iec.tryBeginOffset);
+			writer.WriteUInt32((uint32_t)iec.tryEndOffset);
+			writer.WriteUInt32((uint32_t)iec.handlerBeginOffset);
+			writer.WriteUInt32((uint32_t)iec.handlerEndOffset);
+			writer.WriteUInt32((uint32_t)iec.filterBeginOffset);
+		}
+		writer.WriteUInt32(imi->leaveFinallyClauseIndexCount);
+		writer.WriteBytes(imi->leaveFinallyClauseIndexes, imi->leaveFinallyClauseIndexCount * sizeof(int32_t));
+
+		size_t relocCountPos = writer.GetPosition();
+		writer.WriteUInt32(0);
+		uint32_t relocCount = 0;
+
+		auto addRelocation = [&](RelocationKind kind, RelocationTarget target, uint32_t position, const void* ptr)
+		{
+			writer.WriteByte((uint8_t)kind);
+			writer.WriteByte((uint8_t)target);
+			writer.WriteUInt32(position);
+			++relocCount;
+			return WriteReference(writer, image, kind, ptr);
+		};
+
+		std::vector<bool> relocatedResolveDatas(resolveDataCount);
+		InstructionRelocation instRelocs[kMaxInstructionRelocationCount];
+		for (uint32_t offset = 0; offset < imi->codeLength; )
+		{
+			HiOpcodeEnum op = *(HiOpcodeEnum*)(imi->codes + offset);
+			int32_t instRelocCount = GetInstructionRelocations(op, instRelocs);
+			if (instRelocCount < 0)
+			{
+				return false;
+			}
+			HiOpcodeEnum cctorCheckedOp = GetCCtorCheckedStaticFieldOpcode(op);
+			if (cctorCheckedOp != op)
+			{
+				// 类构造函数在本进程已执行完,加载缓存的进程中未必执行过,需还原为检查类构造函数的版本
+				IL2CPP_ASSERT(instRelocCount == 1 && instRelocs[0].kind == RelocationKind::Class);
+				const Il2CppClass* klass = *(Il2CppClass**)(imi->codes + offset + instRelocs[0].fieldOffset);
+				if (klass->has_cctor)
+				{
+					writer.WriteUInt16At(codePos + offset, (uint16_t)cctorCheckedOp);
+				}
+			}
+			for (int32_t i = 0; i < instRelocCount; i++)
+			{
+				const InstructionRelocation& reloc = instRelocs[i];
+				uint32_t fieldPos = offset + reloc.fieldOffset;
+				if (reloc.kind == RelocationKind::InlineCache)
+				{
+					uint32_t dataIdx = *(uint32_t*)(imi->codes + fieldPos);
+					IL2CPP_ASSERT(dataIdx + kVirtualCallInlineCacheSlotCount <= resolveDataCount);
+					writer.ZeroBytesAt(resolveDataPos + dataIdx * sizeof(void*), kVirtualCallInlineCacheSlotCount * sizeof(void*));
+				}
+				else if (reloc.resolveDataIndex)
+				{
+					uint32_t dataIdx = *(uint32_t*)(imi->codes + fieldPos);
+					IL2CPP_ASSERT(dataIdx < resolveDataCount);
+					const void* ptr = imi->resolveDatas[dataIdx];
+					if (!ptr || relocatedResolveDatas[dataIdx])
+					{
+						continue;
+					}
+					relocatedResolveDatas[dataIdx] = true;
+					writer.ZeroBytesAt(resolveDataPos + dataIdx * sizeof(void*), sizeof(void*));
+					if (!addRelocation(reloc.kind, RelocationTarget::ResolveData, dataIdx, ptr))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					const void* ptr = *(void**)(imi->codes + fieldPos);
+					if (!ptr)
+					{
+						continue;
+					}
+					writer.ZeroBytesAt(codePos + fieldPos, sizeof(void*));
+					if (!addRelocation(reloc.kind, RelocationTarget::Code, fieldPos, ptr))
+					{
+						return false;
+					}
+				}
+			}
+			offset += g_instructionSizes[(int)op];
+		}
+
+		for (uint32_t i = 0; i < imi->exClauseCount; i++)
+		{
+			const Il2CppClass* exKlass = imi->exClauses[i].exKlass;
+			if (exKlass && !addRelocation(RelocationKind::Class, RelocationTarget::ExceptionClause, i, exKlass))
+			{
+				return false;
+			}
+		}
+		writer.WriteUInt32At(relocCountPos, relocCount);
+		return true;
+	}
+
+	static bool ReadMethodData(CacheReader& reader, metadata::Image* image, const MethodInfo* methodInfo, InterpMethodInfo& result)
+	{
+		uint32_t argCount = reader.ReadUInt32();
+		uint32_t argStackObjectSize = reader.ReadUInt32();
+		uint32_t codeLength = reader.ReadUInt32();
+		uint32_t maxStackSize = reader.ReadUInt32();
+		uint32_t localVarBaseOffset = reader.ReadUInt32();
+		uint32_t evalStackBaseOffset = reader.ReadUInt32();
+		uint32_t localStackSize = reader.ReadUInt32();
+		uint32_t isTrivialCopyArgs = reader.ReadUInt32();
+		uint32_t isOptimized = reader.ReadUInt32();
+		if (reader.IsFailed() || argCount != (uint32_t)(methodInfo->parameters_count + (metadata::IsInstanceMethod(methodInfo) ? 1 : 0)))
+		{
+			return false;
+		}
+
+		ArgDesc* args = argCount > 0 ? (ArgDesc*)IL2CPP_CALLOC(argCount, sizeof(ArgDesc)) : nullptr;
+		for (uint32_t i = 0; i < argCount; i++)
+		{
+			args[i].type = (LocationDataType)reader.ReadUInt32();
+			args[i].stackObjectSize = reader.ReadUInt32();
+		}
+
+		uint32_t resolveDataCount = reader.ReadUInt32();
+		const byte* resolveDataBytes = reader.ReadBytes((size_t)resolveDataCount * sizeof(void*));
+		const byte* codeBytes = reader.ReadBytes(codeLength);
+		uint32_t exClauseCount = reader.ReadUInt32();
+		std::vector<InterpExceptionClause> exClauses;
+		for (uint32_t i = 0; i < exClauseCount && !reader.IsFailed(); i++)
+		{
+			InterpExceptionClause iec = {};
+			iec.flags = (metadata::CorILExceptionClauseType)reader.ReadUInt32();
+			iec.tryBeginOffset = (int32_t)reader.ReadUInt32();
+			iec.tryEndOffset = (int32_t)reader.ReadUInt32();
+			iec.handlerBeginOffset = (int32_t)reader.ReadUInt32();
+			iec.handlerEndOffset = (int32_t)reader.ReadUInt32();
+			iec.filterBeginOffset = (int32_t)reader.ReadUInt32();
+			exClauses.push_back(iec);
+		}
+		uint32_t leaveFinallyClauseIndexCount = reader.ReadUInt32();
+		const byte* leaveFinallyClauseIndexBytes = reader.ReadBytes((size_t)leaveFinallyClauseIndexCount * sizeof(int32_t));
+
+		byte* codes = nullptr;
+		std::vector<const void*> resolveDatas;
+		bool ok = !reader.IsFailed() && codeLength > 0;
+		if (ok)
+		{
+			codes = (byte*)IL2CPP_MALLOC(codeLength);
+			std::memcpy(codes, codeBytes, codeLength);
+			resolveDatas.resize(resolveDataCount);
+			std::memcpy(resolveDatas.data(), resolveDataBytes, (size_t)resolveDataCount * sizeof(void*));
+
+			uint32_t relocCount = reader.ReadUInt32();
+			for (uint32_t i = 0; i < relocCount && ok; i++)
+			{
+				RelocationKind kind = (RelocationKind)reader.ReadByte();
+				RelocationTarget target = (RelocationTarget)reader.ReadByte();
+				uint32_t position = reader.ReadUInt32();
+				const void* ptr = reader.IsFailed() ? nullptr : ReadReference(reader, image, kind);
+				if (!ptr)
+				{
+					ok = false;
+					break;
+				}
+				switch (target)
+				{
+				case RelocationTarget::Code:
+				{
+					ok = (uint64_t)position + sizeof(void*) <= codeLength;
+					if (ok)
+					{
+						*(const void**)(codes + position) = ptr;
+					}
+					break;
+				}
+				case RelocationTarget::ResolveData:
+				{
+					ok = position < resolveDataCount;
+					if (ok)
+					{
+						resolveDatas[position] = ptr;
+					}
+					break;
+				}
+				case RelocationTarget::ExceptionClause:
+				{
+					ok = position < exClauseCount && kind == RelocationKind::Class;
+					if (ok)
+					{
+						exClauses[position].exKlass = (Il2CppClass*)ptr;
+					}
+					break;
+				}
+				default:
+				{
+					ok = false;
+					break;
+				}
+				}
+			}
+			ok = ok && !reader.IsFailed() && reader.IsEnd();
+		}
+
+		if (!ok)
+		{
+			IL2CPP_FREE(codes);
+			IL2CPP_FREE(args);
+			return false;
+		}
+
+		result.method = methodInfo;
+		result.args = args;
+		result.argCount = argCount;
+		result.argStackObjectSize = argStackObjectSize;
+		result.codes = codes;
+		result.codeLength = codeLength;
+		result.maxStackSize = maxStackSize;
+		result.localVarBaseOffset = localVarBaseOffset;
+		result.evalStackBaseOffset = evalStackBaseOffset;
+		result.localStackSize = localStackSize;
+		result.resolveDatas.swap(resolveDatas);
+		result.exClauseCount = exClauseCount;
+		result.exClauses = nullptr;
+		if (exClauseCount > 0)
+		{
+			result.exClauses = (InterpExceptionClause*)IL2CPP_MALLOC(exClauseCount * sizeof(InterpExceptionClause));
+			std::memcpy(result.exClauses, exClauses.data(), exClauseCount * sizeof(InterpExceptionClause));
+		}
+		result.leaveFinallyClauseIndexCount = leaveFinallyClauseIndexCount;
+		result.leaveFinallyClauseIndexes = nullptr;
+		if (leaveFinallyClauseIndexCount > 0)
+		{
+			result.leaveFinallyClauseIndexes = (int32_t*)IL2CPP_MALLOC(leaveFinallyClauseIndexCount * sizeof(int32_t));
+			std::memcpy(result.leaveFinallyClauseIndexes, leaveFinallyClauseIndexBytes, leaveFinallyClauseIndexCount * sizeof(int32_t));
+		}
+		result.isTrivialCopyArgs = isTrivialCopyArgs != 0;
+		result.isOptimized = isOptimized != 0;
+		return true;
+	}
+
+#pragma endregion
+
+	struct CacheEntry
+	{
+		const byte* data;
+		uint32_t size;
+	};
+
+	struct ImageTransformCache
+	{
+		bool loaded;
+		void* fileBuffer;
+		std::unordered_map<std::string, CacheEntry> entries;
+		std::vector<const InterpMethodInfo*> transformedMethods;
+	};
+
+	static std::string s_cacheDir;
+	static std::unordered_map<metadata::Image*, ImageTransformCache*> s_imageCaches;
+
+	static std::string GetCacheFilePath(metadata::Image* image)
+	{
+		return il2cpp::utils::PathUtils::Combine(s_cacheDir, std::string(image->GetIl2CppImage()->nameNoExt) + ".htc");
+	}
+
+	static uint32_t ComputeInstructionSetHash()
+	{
+		uint32_t hash = (uint32_t)HiOpcodeEnum::__Count;
+		for (int32_t i = 0; i < (int32_t)HiOpcodeEnum::__Count; i++)
+		{
+			hash = hash * 31 + g_instructionSizes[i];
+		}
+		return hash;
+	}
+
+	static void WriteFileHeader(CacheWriter& writer, metadata::Image* image)
+	{
+		writer.WriteUInt32(kTransformCacheMagic);
+		writer.WriteUInt32(kTransformCacheVersion);
+		writer.WriteBytes(image->GetModuleMvid(), 16);
+		// 指令集或指针宽度变化后旧缓存不再可用
+		writer.WriteUInt32(ComputeInstructionSetHash());
+		writer.WriteUInt32((uint32_t)sizeof(void*));
+	}
+
+	static void CloseCacheFile(ImageTransformCache& cache)
+	{
+		if (cache.fileBuffer)
+		{
+			il2cpp::utils::MemoryMappedFile::Unmap(cache.fileBuffer);
+			cache.fileBuffer = nullptr;
+		}
+		cache.entries.clear();
+		cache.loaded = false;
+	}
+
+	static void LoadCacheFile(metadata::Image* image, ImageTransformCache& cache)
+	{
+		cache.loaded = true;
+		void* fileBuffer;
+		uint64_t fileLength;
+		if (!metadata::GetMappedFileBuffer(GetCacheFilePath(image).c_str(), fileBuffer, fileLength))
+		{
+			return;
+		}
+		cache.fileBuffer = fileBuffer;
+
+		std::vector<byte> expectHeader;
+		CacheWriter headerWriter(expectHeader);
+		WriteFileHeader(headerWriter, image);
+
+		CacheReader reader((const byte*)fileBuffer, (size_t)fileLength);
+		const byte* header = reader.ReadBytes(expectHeader.size());
+		if (!header || std::memcmp(header, expectHeader.data(), expectHeader.size()) != 0)
+		{
+			// dll已更新,整个缓存作废
+			CloseCacheFile(cache);
+			cache.loaded = true;
+			return;
+		}
+		uint32_t entryCount = reader.ReadUInt32();
+		for (uint32_t i = 0; i < entryCount; i++)
+		{
+			uint32_t keySize = reader.ReadUInt32();
+			const byte* key = reader.ReadBytes(keySize);
+			uint32_t dataSize = reader.ReadUInt32();
+			const byte* data = reader.ReadBytes(dataSize);
+			if (reader.IsFailed())
+			{
+				CloseCacheFile(cache);
+				cache.loaded = true;
+				return;
+			}
+			cache.entries[std::string((const char*)key, keySize)] = { data, dataSize };
+		}
+	}
+
+	static ImageTransformCache& GetImageCache(metadata::Image* image)
+	{
+		auto it = s_imageCaches.find(image);
+		if (it != s_imageCaches.end())
+		{
+			return *it->second;
+		}
+		ImageTransformCache* cache = new ImageTransformCache();
+		cache->loaded = false;
+		cache->fileBuffer = nullptr;
+		s_imageCaches.insert({ image, cache });
+		return *cache;
+	}
+
+	void TransformCache::SetCacheDirectory(const char* dir)
+	{
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		for (auto& e : s_imageCaches)
+		{
+			CloseCacheFile(*e.second);
+		}
+		s_cacheDir = dir ? dir : "";
+	}
+
+	bool TransformCache::TryLoad(metadata::Image* image, const MethodInfo* methodInfo, InterpMethodInfo& result)
+	{
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		if (s_cacheDir.empty())
+		{
+			return false;
+		}
+		ImageTransformCache& cache = GetImageCache(image);
+		if (!cache.loaded)
+		{
+			LoadCacheFile(image, cache);
+		}
+		if (cache.entries.empty())
+		{
+			return false;
+		}
+		std::vector<byte> key;
+		CacheWriter keyWriter(key);
+		if (!WriteMethodKey(keyWriter, methodInfo))
+		{
+			return false;
+		}
+		auto it = cache.entries.find(std::string((const char*)key.data(), key.size()));
+		if (it == cache.entries.end())
+		{
+			return false;
+		}
+		CacheReader reader(it->second.data, it->second.size);
+		return ReadMethodData(reader, image, methodInfo, result);
+	}
+
+	void TransformCache::AddTransformedMethod(metadata::Image* image, const InterpMethodInfo* imi)
+	{
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		if (s_cacheDir.empty())
+		{
+			return;
+		}
+		GetImageCache(image).transformedMethods.push_back(imi);
+	}
+
+	static bool WriteFile(const std::string& path, const std::vector<byte>& data)
+	{
+		int err = 0;
+		il2cpp::os::FileHandle* fh = il2cpp::os::File::Open(path, kFileModeCreate, kFileAccessWrite, kFileShareNone, 0, &err);
+		if (err != 0)
+		{
+			return false;
+		}
+		int32_t writeSize = il2cpp::os::File::Write(fh, (const char*)data.data(), (int)data.size(), &err);
+		bool ok = err == 0 && writeSize == (int32_t)data.size();
+		il2cpp::os::File::Close(fh, &err);
+		return ok && err == 0;
+	}
+
+	void TransformCache::Save()
+	{
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		if (s_cacheDir.empty())
+		{
+			return;
+		}
+		for (auto& e : s_imageCaches)
+		{
+			metadata::Image* image = e.first;
+			ImageTransformCache& cache = *e.second;
+			if (cache.transformedMethods.empty())
+			{
+				continue;
+			}
+			if (!cache.loaded)
+			{
+				LoadCacheFile(image, cache);
+			}
+
+			std::unordered_map<std::string, std::vector<byte>> newEntries;
+			for (const InterpMethodInfo* imi : cache.transformedMethods)
+			{
+				std::vector<byte> key;
+				CacheWriter keyWriter(key);
+				std::vector<byte> data;
+				CacheWriter dataWriter(data);
+				// 包含无法重定位数据的函数不缓存,下次启动照常转换
+				if (WriteMethodKey(keyWriter, imi->method) && WriteMethodData(dataWriter, image, imi))
+				{
+					newEntries[std::string((const char*)key.data(), key.size())].swap(data);
+				}
+			}
+
+			std::vector<byte> file;
+			CacheWriter writer(file);
+			WriteFileHeader(writer, image);
+			size_t entryCountPos = writer.GetPosition();
+			writer.WriteUInt32(0);
+			uint32_t entryCount = 0;
+			for (auto& entry : cache.entries)
+			{
+				if (newEntries.find(entry.first) != newEntries.end())
+				{
+					continue;
+				}
+				writer.WriteUInt32((uint32_t)entry.first.size());
+				writer.WriteBytes(entry.first.data(), entry.first.size());
+				writer.WriteUInt32(entry.second.size);
+				writer.WriteBytes(entry.second.data, entry.second.size);
+				++entryCount;
+			}
+			for (auto& entry : newEntries)
+			{
+				writer.WriteUInt32((uint32_t)entry.first.size());
+				writer.WriteBytes(entry.first.data(), entry.first.size());
+				writer.WriteUInt32((uint32_t)entry.second.size());
+				writer.WriteBytes(entry.second.data(), entry.second.size());
+				++entryCount;
+			}
+			writer.WriteUInt32At(entryCountPos, entryCount);
+
+			// 先写临时文件再替换,写入中途失败不会破坏旧缓存
+			std::string path = GetCacheFilePath(image);
+			std::string tmpPath = path + ".tmp";
+			CloseCacheFile(cache);
+			int err = 0;
+			if (WriteFile(tmpPath, file))
+			{
+				il2cpp::os::File::DeleteFile(path, &err);
+				il2cpp::os::File::MoveFile(tmpPath, path, &err);
+			}
+			cache.transformedMethods.clear();
+		}
+	}
+}
+}
+
+void huatuo_set_transform_cache_directory(const char* dir)
+{
+	huatuo::transform::TransformCache::SetCacheDirectory(dir);
+}
+
+void huatuo_save_transform_cache()
+{
+	huatuo::transform::TransformCache::Save();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../CommonDef.h"
+#include "../metadata/Image.h"
+#include "../interpreter/Interpreter.h"
+
+namespace huatuo
+{
+namespace transform
+{
+	// 转换结果的磁盘缓存。每个热更新dll对应一个缓存文件,文件头记录dll的MVID,不匹配时整个文件作废。
+	// 缓存项以 method token + 泛型实例化参数 为key,codes与resolveDatas中的运行时指针
+	// 以可重定位的形式(类型、方法、managed2native签名、user string)保存,加载时重新解析。
+	class TransformCache
+	{
+	public:
+		// 缓存目录需已存在。未设置时不读写缓存
+		static void SetCacheDirectory(const char* dir);
+
+		static bool TryLoad(metadata::Image* image, const MethodInfo* methodInfo, interpreter::InterpMethodInfo& result);
+
+		static void AddTransformedMethod(metadata::Image* image, const interpreter::InterpMethodInfo* imi);
+
+		// 把已有缓存项与新转换的函数一起写回缓存文件
+		static void Save();
+	};
+}
+}
+
+extern "C"
+{
+	IL2CPP_EXPORT void huatuo_set_transform_cache_directory(const char* dir);
+	IL2CPP_EXPORT void huatuo_save_transform_cache();
+}
@@ -36,6 +36,10 @@ extern "C" {
 }
 #endif
 
+//==={{ huatuo
+#include "huatuo/ModuleManager.h"
+//===}} huatuo
+
 namespace il2cpp
 {
 namespace vm
@@ -212,6 +216,10 @@ namespace vm
             MONO_PROFILER_RAISE(thread_stopped, ((uintptr_t)thread->GetInternalThread()->tid));
 #endif
 
+        //==={{ huatuo
+        huatuo::ModuleManager::UninitializeCurrentThread();
+        //===}} huatuo
+
         Unregister(thread);
         FreeThreadStaticData(thread);
 